@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "angular-sort.h"
+#include "inputs.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+
+    // Как сортировали раньше: угол через atan2 на каждое сравнение.
+    void BM_SortByAtan2(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            state.PauseTiming();
+            std::vector<Vector> copy = points;
+            state.ResumeTiming();
+            std::sort(copy.begin(), copy.end(), [](const Vector &a, const Vector &b) {
+                return std::atan2(a.y_, a.x_) < std::atan2(b.y_, b.x_);
+            });
+            benchmark::DoNotOptimize(copy.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void BM_SortAngleLess(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            state.PauseTiming();
+            std::vector<Vector> copy = points;
+            state.ResumeTiming();
+            std::sort(copy.begin(), copy.end(), [](const Vector &a, const Vector &b) {
+                return olymp_geometry::AngleLess(a, b);
+            });
+            benchmark::DoNotOptimize(copy.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void BM_SortByAngle(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            state.PauseTiming();
+            std::vector<Vector> copy = points;
+            state.ResumeTiming();
+            olymp_geometry::SortByAngle(copy);
+            benchmark::DoNotOptimize(copy.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+}
+
+BENCHMARK(BM_SortByAtan2)->Apply(AllInputs);
+BENCHMARK(BM_SortAngleLess)->Apply(AllInputs);
+BENCHMARK(BM_SortByAngle)->Apply(AllInputs);
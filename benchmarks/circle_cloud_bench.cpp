@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "circle-cloud.h"
+#include "inputs.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+using olymp_geometry::bench::MakeSegments;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+    using Segment = olymp_geometry::BasicSegment<double>;
+    using Circle = olymp_geometry::BasicCircle<double>;
+
+    // Центры из входа, радиусы от 0 до 49.
+    std::vector<Circle> MakeCircles(const Input &input) {
+        std::vector<Vector> centers = MakePoints(input);
+        std::vector<Circle> circles;
+        circles.reserve(centers.size());
+        for (std::size_t i = 0; i < centers.size(); ++i) {
+            circles.emplace_back(centers[i], static_cast<double>(i % 50));
+        }
+        return circles;
+    }
+
+    const Circle kQueryCircle(Vector(10, -20), 300);
+    const Line kQueryLine(Vector(-3, 7), Vector(11, -2));
+
+    // Один круг против набора отрезков: скалярный цикл и пакетные ядра.
+
+    void BM_IntersectCircleSegments(benchmark::State &state) {
+        auto segments = MakeSegments(Input(state));
+        for (auto _ : state) {
+            for (const Segment &s : segments) {
+                benchmark::DoNotOptimize(olymp_geometry::Intersect(kQueryCircle, s));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.size()));
+    }
+
+    void BM_IntersectMaskCircleSegmentCloud(benchmark::State &state) {
+        olymp_geometry::SegmentCloud segments(MakeSegments(Input(state)));
+        std::vector<uint64_t> mask((segments.Size() + 63) / 64);
+        for (auto _ : state) {
+            olymp_geometry::IntersectMask(kQueryCircle, segments, mask.data());
+            benchmark::DoNotOptimize(mask.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.Size()));
+    }
+
+    void BM_DistCircleSegments(benchmark::State &state) {
+        auto segments = MakeSegments(Input(state));
+        for (auto _ : state) {
+            for (const Segment &s : segments) {
+                benchmark::DoNotOptimize(olymp_geometry::Dist(kQueryCircle, s));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.size()));
+    }
+
+    void BM_DistCircleSegmentCloud(benchmark::State &state) {
+        olymp_geometry::SegmentCloud segments(MakeSegments(Input(state)));
+        std::vector<double> out(segments.Size());
+        for (auto _ : state) {
+            olymp_geometry::Dist(kQueryCircle, segments, out.data());
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.Size()));
+    }
+
+    // Одна прямая против набора кругов.
+
+    void BM_IntersectLineCircles(benchmark::State &state) {
+        auto circles = MakeCircles(Input(state));
+        for (auto _ : state) {
+            for (const Circle &c : circles) {
+                benchmark::DoNotOptimize(olymp_geometry::Intersect(c, kQueryLine));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * circles.size()));
+    }
+
+    void BM_IntersectMaskLineCircleCloud(benchmark::State &state) {
+        olymp_geometry::CircleCloud circles(MakeCircles(Input(state)));
+        std::vector<uint64_t> mask((circles.Size() + 63) / 64);
+        for (auto _ : state) {
+            olymp_geometry::IntersectMask(kQueryLine, circles, mask.data());
+            benchmark::DoNotOptimize(mask.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * circles.Size()));
+    }
+
+    void BM_DistLineCircles(benchmark::State &state) {
+        auto circles = MakeCircles(Input(state));
+        for (auto _ : state) {
+            for (const Circle &c : circles) {
+                benchmark::DoNotOptimize(olymp_geometry::Dist(c, kQueryLine));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * circles.size()));
+    }
+
+    void BM_DistLineCircleCloud(benchmark::State &state) {
+        olymp_geometry::CircleCloud circles(MakeCircles(Input(state)));
+        std::vector<double> out(circles.Size());
+        for (auto _ : state) {
+            olymp_geometry::Dist(kQueryLine, circles, out.data());
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * circles.Size()));
+    }
+}
+
+BENCHMARK(BM_IntersectCircleSegments)->Apply(AllInputs);
+BENCHMARK(BM_IntersectMaskCircleSegmentCloud)->Apply(AllInputs);
+BENCHMARK(BM_DistCircleSegments)->Apply(AllInputs);
+BENCHMARK(BM_DistCircleSegmentCloud)->Apply(AllInputs);
+BENCHMARK(BM_IntersectLineCircles)->Apply(AllInputs);
+BENCHMARK(BM_IntersectMaskLineCircleCloud)->Apply(AllInputs);
+BENCHMARK(BM_DistLineCircles)->Apply(AllInputs);
+BENCHMARK(BM_DistLineCircleCloud)->Apply(AllInputs);
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "clipping.h"
+#include "inputs.h"
+
+using olymp_geometry::bench::Distribution;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+
+    // n квадратов со стороной 40 вокруг случайных точек, все вершины в одном массиве.
+    struct Quads {
+        std::vector<Vector> vertices_;
+        std::vector<std::size_t> offsets_ = {0};
+    };
+
+    Quads MakeQuads(std::size_t n) {
+        Quads quads;
+        for (const Vector &p : MakePoints(Input(n, Distribution::kRandom))) {
+            quads.vertices_.insert(quads.vertices_.end(),
+                                   {p + Vector(-20, -20), p + Vector(20, -20),
+                                    p + Vector(20, 20), p + Vector(-20, 20)});
+            quads.offsets_.push_back(quads.vertices_.size());
+        }
+        return quads;
+    }
+
+    const olymp_geometry::BasicPolygon<double> kWindow{
+            {-500, -500}, {500, -500}, {500, 500}, {-500, 500}};
+
+    // Пакетное отсечение в переиспользуемые буферы: после первой итерации без выделений.
+    void BM_ClipByWindowBatch(benchmark::State &state) {
+        Quads quads = MakeQuads(static_cast<std::size_t>(state.range(0)));
+        olymp_geometry::ClipBuffers<double> buffers;
+        std::vector<Vector> out;
+        std::vector<std::size_t> out_offsets;
+        for (auto _ : state) {
+            olymp_geometry::ClipByWindow(quads.vertices_, quads.offsets_, kWindow, out,
+                                         out_offsets, buffers);
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // То же с новыми буферами и вектором на каждый многоугольник, как при наивном отсечении.
+    void BM_ClipByWindowAllocating(benchmark::State &state) {
+        Quads quads = MakeQuads(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state) {
+            std::vector<std::vector<Vector>> out;
+            for (std::size_t i = 0; i + 1 < quads.offsets_.size(); ++i) {
+                std::vector<Vector> polygon(quads.vertices_.begin() + quads.offsets_[i],
+                                            quads.vertices_.begin() + quads.offsets_[i + 1]);
+                olymp_geometry::ClipBuffers<double> buffers;
+                out.push_back(olymp_geometry::ClipByWindow(polygon, kWindow, buffers));
+            }
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_ClipByLineBatch(benchmark::State &state) {
+        Quads quads = MakeQuads(static_cast<std::size_t>(state.range(0)));
+        olymp_geometry::ClipBuffers<double> buffers;
+        std::vector<Vector> out;
+        std::vector<std::size_t> out_offsets;
+        Line line(Vector(-3, 7), Vector(11, -2));
+        for (auto _ : state) {
+            olymp_geometry::ClipByLine(quads.vertices_, quads.offsets_, line, Vector(0, 0), out,
+                                       out_offsets, buffers);
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_ClipByWindowBatch)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
+BENCHMARK(BM_ClipByWindowAllocating)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
+BENCHMARK(BM_ClipByLineBatch)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
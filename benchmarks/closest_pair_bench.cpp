@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "closest-pair.h"
+#include "inputs.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+
+namespace {
+    void BM_ClosestPair(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::ClosestPair(points));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void BM_ClosestPairSingleThread(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        olymp_geometry::SetThreadCount(1);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::ClosestPair(points));
+        }
+        olymp_geometry::SetThreadCount(0);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void BM_FindClosePairs(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::FindClosePairs(points, 0.01));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+}
+
+BENCHMARK(BM_ClosestPair)->Apply(AllInputs);
+BENCHMARK(BM_ClosestPairSingleThread)->Apply(AllInputs);
+// На вырожденных входах пар Theta(n^2), поэтому только случайные точки.
+BENCHMARK(BM_FindClosePairs)
+        ->ArgsProduct({benchmark::CreateRange(10, 10'000'000, 10), {0}})
+        ->ArgNames({"n", "distribution"});
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "convex-hull.h"
+#include "inputs.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+
+namespace {
+    void BM_ConvexHull(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::ConvexHull(points));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void BM_ConvexHullSingleThread(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        olymp_geometry::SetThreadCount(1);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::ConvexHull(points));
+        }
+        olymp_geometry::SetThreadCount(0);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    // Монотонная цепочка без отсева: сортировка всех n точек.
+    void BM_MonotoneChainOnly(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            std::vector<olymp_geometry::BasicVector<double>> copy = points;
+            benchmark::DoNotOptimize(olymp_geometry::detail::SortedHull(copy, false));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+}
+
+BENCHMARK(BM_ConvexHull)->Apply(AllInputs);
+BENCHMARK(BM_ConvexHullSingleThread)->Apply(AllInputs);
+BENCHMARK(BM_MonotoneChainOnly)->Apply(AllInputs);
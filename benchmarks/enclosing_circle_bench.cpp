@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "enclosing-circle.h"
+#include "inputs.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+
+namespace {
+    // Точки перемешиваются на месте, поэтому каждая итерация начинает с нового порядка без
+    // копирования.
+    void BM_MinEnclosingCircle(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        uint64_t seed = 0;
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::MinEnclosingCircle(points, seed++));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    // Группы по 100 точек, всего state.range(0) точек.
+    void BM_MinEnclosingCircles(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        std::vector<std::vector<olymp_geometry::BasicVector<double>>> groups;
+        for (std::size_t i = 0; i < points.size(); i += 100) {
+            groups.emplace_back(points.begin() + i,
+                                points.begin() + std::min(points.size(), i + 100));
+        }
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::MinEnclosingCircles(groups));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+}
+
+BENCHMARK(BM_MinEnclosingCircle)->Apply(AllInputs);
+BENCHMARK(BM_MinEnclosingCircles)->Apply(AllInputs);
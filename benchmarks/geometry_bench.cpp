@@ -0,0 +1,374 @@
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "fast-io.h"
+#include "inputs.h"
+#include "olymp-geometry.h"
+#include "point-cloud.h"
+#include "segment-cloud.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakeBeams;
+using olymp_geometry::bench::MakeLines;
+using olymp_geometry::bench::MakePoints;
+using olymp_geometry::bench::MakeSegments;
+using olymp_geometry::bench::Pairwise;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+    using Segment = olymp_geometry::BasicSegment<double>;
+    using Beam = olymp_geometry::BasicBeam<double>;
+
+    // Умножения и углы
+
+    void BM_ScalarMultiplication(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        Pairwise(state, points, points, [](const Vector &a, const Vector &b) {
+            return olymp_geometry::ScalarMultiplication(a, b);
+        });
+    }
+
+    void BM_VectorMultiplication(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        Pairwise(state, points, points, [](const Vector &a, const Vector &b) {
+            return olymp_geometry::VectorMultiplication(a, b);
+        });
+    }
+
+    void BM_AngleCos(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        Pairwise(state, points, points, [](const Vector &a, const Vector &b) {
+            return olymp_geometry::AngleCos(a, b);
+        });
+    }
+
+    void BM_Angle(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        Pairwise(state, points, points, [](const Vector &a, const Vector &b) {
+            return olymp_geometry::Angle(a, b);
+        });
+    }
+
+    void BM_IsBetween(benchmark::State &state) {
+        Input input(state);
+        auto segments = MakeSegments(input);
+        auto points = MakePoints(input);
+        Pairwise(state, segments, points, [](const Segment &s, const Vector &m) {
+            return olymp_geometry::IsBetween(s.a_, s.b_, m);
+        });
+    }
+
+    // Взаимное положение
+
+    void BM_LineFromPoints(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        Pairwise(state, points, points, [](const Vector &a, const Vector &b) {
+            return Line(a, b);
+        });
+    }
+
+    void BM_LineEquality(benchmark::State &state) {
+        auto lines = MakeLines(MakeSegments(Input(state)));
+        Pairwise(state, lines, lines, [](const Line &a, const Line &b) { return a == b; });
+    }
+
+    void BM_Orient2D(benchmark::State &state) {
+        Input input(state);
+        auto segments = MakeSegments(input);
+        auto points = MakePoints(input);
+        Pairwise(state, segments, points, [](const Segment &s, const Vector &v) {
+            return olymp_geometry::Orient2D(s.a_, s.b_, v);
+        });
+    }
+
+    void BM_SideOfLine(benchmark::State &state) {
+        Input input(state);
+        auto lines = MakeLines(MakeSegments(input));
+        auto points = MakePoints(input);
+        Pairwise(state, lines, points, [](const Line &line, const Vector &v) {
+            return olymp_geometry::SideOfLine(line, v);
+        });
+    }
+
+    void BM_OnSameSide(benchmark::State &state) {
+        Input input(state);
+        auto lines = MakeLines(MakeSegments(input));
+        auto segments = MakeSegments(input, 7);
+        Pairwise(state, lines, segments, [](const Line &line, const Segment &s) {
+            return olymp_geometry::OnSameSide(line, s.a_, s.b_);
+        });
+    }
+
+    void BM_OnSameSideEq(benchmark::State &state) {
+        Input input(state);
+        auto lines = MakeLines(MakeSegments(input));
+        auto segments = MakeSegments(input, 7);
+        Pairwise(state, lines, segments, [](const Line &line, const Segment &s) {
+            return olymp_geometry::OnSameSideEq(line, s.a_, s.b_);
+        });
+    }
+
+    void BM_LiesOn(benchmark::State &state) {
+        Input input(state);
+        auto segments = MakeSegments(input);
+        auto points = MakePoints(input);
+        Pairwise(state, segments, points, [](const Segment &s, const Vector &v) {
+            return olymp_geometry::LiesOn(s, v);
+        });
+    }
+
+    void BM_Intersect(benchmark::State &state) {
+        auto segments = MakeSegments(Input(state));
+        Pairwise(state, segments, segments, [](const Segment &a, const Segment &b) {
+            return olymp_geometry::Intersect(a, b);
+        });
+    }
+
+    void BM_IntersectionLines(benchmark::State &state) {
+        auto lines = MakeLines(MakeSegments(Input(state)));
+        Pairwise(state, lines, lines, [](const Line &a, const Line &b) {
+            return olymp_geometry::IntersectionPoint(a, b);
+        });
+    }
+
+    void BM_IntersectionSegments(benchmark::State &state) {
+        auto segments = MakeSegments(Input(state));
+        Pairwise(state, segments, segments, [](const Segment &a, const Segment &b) {
+            return olymp_geometry::Intersection(a, b);
+        });
+    }
+
+    // Пакетная версия без выделения памяти: пары с пересечением отсеиваются ядром IntersectMask.
+    void BM_IntersectionSegmentCloud(benchmark::State &state) {
+        auto segments = MakeSegments(Input(state));
+        std::vector<Segment> shifted(segments.begin() + 1, segments.end());
+        shifted.push_back(segments[0]);
+        olymp_geometry::SegmentCloud first(segments), second(shifted);
+        std::vector<olymp_geometry::IntersectionResult<double>> out(segments.size());
+        for (auto _ : state) {
+            olymp_geometry::Intersection(first, second, out.data());
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.size()));
+    }
+
+    // Расстояния
+
+    void BM_DistVector(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        Pairwise(state, points, points, [](const Vector &a, const Vector &b) {
+            return olymp_geometry::Dist(a, b);
+        });
+    }
+
+    void BM_DistLine(benchmark::State &state) {
+        Input input(state);
+        auto lines = MakeLines(MakeSegments(input));
+        auto points = MakePoints(input);
+        Pairwise(state, lines, points, [](const Line &line, const Vector &v) {
+            return olymp_geometry::Dist(line, v);
+        });
+    }
+
+    void BM_DistBeam(benchmark::State &state) {
+        Input input(state);
+        auto beams = MakeBeams(MakeSegments(input));
+        auto points = MakePoints(input);
+        Pairwise(state, beams, points, [](const Beam &beam, const Vector &v) {
+            return olymp_geometry::Dist(beam, v);
+        });
+    }
+
+    void BM_DistSegment(benchmark::State &state) {
+        Input input(state);
+        auto segments = MakeSegments(input);
+        auto points = MakePoints(input);
+        Pairwise(state, segments, points, [](const Segment &s, const Vector &v) {
+            return olymp_geometry::Dist(s, v);
+        });
+    }
+
+    void BM_DistSquaredVector(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        Pairwise(state, points, points, [](const Vector &a, const Vector &b) {
+            return olymp_geometry::DistSquared(a, b);
+        });
+    }
+
+    void BM_DistSquaredLine(benchmark::State &state) {
+        Input input(state);
+        auto lines = MakeLines(MakeSegments(input));
+        auto points = MakePoints(input);
+        Pairwise(state, lines, points, [](const Line &line, const Vector &v) {
+            return olymp_geometry::DistSquared(line, v);
+        });
+    }
+
+    void BM_DistSquaredBeam(benchmark::State &state) {
+        Input input(state);
+        auto beams = MakeBeams(MakeSegments(input));
+        auto points = MakePoints(input);
+        Pairwise(state, beams, points, [](const Beam &beam, const Vector &v) {
+            return olymp_geometry::DistSquared(beam, v);
+        });
+    }
+
+    void BM_DistSquaredSegment(benchmark::State &state) {
+        Input input(state);
+        auto segments = MakeSegments(input);
+        auto points = MakePoints(input);
+        Pairwise(state, segments, points, [](const Segment &s, const Vector &v) {
+            return olymp_geometry::DistSquared(s, v);
+        });
+    }
+
+    // Одна прямая против всех точек: корень в каждом Dist(Line) против одного корня при
+    // построении NormalizedLine.
+
+    void BM_DistOneLine(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        Line line(Vector(-3, 7), Vector(11, -2));
+        for (auto _ : state) {
+            for (const Vector &v : points) {
+                benchmark::DoNotOptimize(olymp_geometry::Dist(line, v));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void BM_DistOneNormalizedLine(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            olymp_geometry::BasicNormalizedLine<double> line(Vector(-3, 7), Vector(11, -2));
+            for (const Vector &v : points) {
+                benchmark::DoNotOptimize(olymp_geometry::Dist(line, v));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void BM_SignedDistPointCloud(benchmark::State &state) {
+        olymp_geometry::PointCloud points(MakePoints(Input(state)));
+        std::vector<double> out(points.Size());
+        for (auto _ : state) {
+            olymp_geometry::BasicNormalizedLine<double> line(Vector(-3, 7), Vector(11, -2));
+            olymp_geometry::SignedDist(line, points, out.data());
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.Size()));
+    }
+
+    // Ввод-вывод точек: iostream против fast-io.h
+
+    std::string FormatPoints(const std::vector<Vector> &points) {
+        std::ostringstream out;
+        olymp_geometry::FastWriter writer(out);
+        for (const Vector &p : points) {
+            writer.Write(p).Write('\n');
+        }
+        writer.Flush();
+        return out.str();
+    }
+
+    void BM_ReadIstream(benchmark::State &state) {
+        Input input(state);
+        std::string text = FormatPoints(MakePoints(input));
+        std::vector<Vector> points(input.size_);
+        std::istringstream in(text);
+        for (auto _ : state) {
+            in.clear();
+            in.seekg(0);
+            for (Vector &p : points) {
+                in >> p;
+            }
+            benchmark::DoNotOptimize(points.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * input.size_));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+    }
+
+    void BM_ReadFastReader(benchmark::State &state) {
+        Input input(state);
+        std::string text = FormatPoints(MakePoints(input));
+        std::vector<Vector> points(input.size_);
+        for (auto _ : state) {
+            olymp_geometry::FastReader reader(text);
+            for (Vector &p : points) {
+                reader.Read(p);
+            }
+            benchmark::DoNotOptimize(points.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * input.size_));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+    }
+
+    void BM_WriteOstream(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        std::ostringstream out;
+        for (auto _ : state) {
+            out.str("");
+            for (const Vector &p : points) {
+                out << p << '\n';
+            }
+            benchmark::DoNotOptimize(out.tellp());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void BM_WriteFastWriter(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        std::ostringstream out;
+        for (auto _ : state) {
+            out.str("");
+            olymp_geometry::FastWriter writer(out);
+            for (const Vector &p : points) {
+                writer.Write(p).Write('\n');
+            }
+            writer.Flush();
+            benchmark::DoNotOptimize(out.tellp());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+}
+
+BENCHMARK(BM_ScalarMultiplication)->Apply(AllInputs);
+BENCHMARK(BM_VectorMultiplication)->Apply(AllInputs);
+BENCHMARK(BM_AngleCos)->Apply(AllInputs);
+BENCHMARK(BM_Angle)->Apply(AllInputs);
+BENCHMARK(BM_IsBetween)->Apply(AllInputs);
+
+BENCHMARK(BM_LineFromPoints)->Apply(AllInputs);
+BENCHMARK(BM_LineEquality)->Apply(AllInputs);
+BENCHMARK(BM_Orient2D)->Apply(AllInputs);
+BENCHMARK(BM_SideOfLine)->Apply(AllInputs);
+BENCHMARK(BM_OnSameSide)->Apply(AllInputs);
+BENCHMARK(BM_OnSameSideEq)->Apply(AllInputs);
+BENCHMARK(BM_LiesOn)->Apply(AllInputs);
+BENCHMARK(BM_Intersect)->Apply(AllInputs);
+BENCHMARK(BM_IntersectionLines)->Apply(AllInputs);
+BENCHMARK(BM_IntersectionSegments)->Apply(AllInputs);
+BENCHMARK(BM_IntersectionSegmentCloud)->Apply(AllInputs);
+
+BENCHMARK(BM_DistVector)->Apply(AllInputs);
+BENCHMARK(BM_DistLine)->Apply(AllInputs);
+BENCHMARK(BM_DistBeam)->Apply(AllInputs);
+BENCHMARK(BM_DistSegment)->Apply(AllInputs);
+BENCHMARK(BM_DistSquaredVector)->Apply(AllInputs);
+BENCHMARK(BM_DistSquaredLine)->Apply(AllInputs);
+BENCHMARK(BM_DistSquaredBeam)->Apply(AllInputs);
+BENCHMARK(BM_DistSquaredSegment)->Apply(AllInputs);
+BENCHMARK(BM_DistOneLine)->Apply(AllInputs);
+BENCHMARK(BM_DistOneNormalizedLine)->Apply(AllInputs);
+BENCHMARK(BM_SignedDistPointCloud)->Apply(AllInputs);
+
+BENCHMARK(BM_ReadIstream)->Apply(AllInputs);
+BENCHMARK(BM_ReadFastReader)->Apply(AllInputs);
+BENCHMARK(BM_WriteOstream)->Apply(AllInputs);
+BENCHMARK(BM_WriteFastWriter)->Apply(AllInputs);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "geometry-store.h"
+#include "inputs.h"
+
+using olymp_geometry::bench::Distribution;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+
+    // n фигур по 3-8 вершин, как пакет мелких многоугольников.
+    constexpr std::size_t ShapeSize(std::size_t i) {
+        return 3 + i % 6;
+    }
+
+    // Отдельный вектор на каждую фигуру.
+    void BM_BuildVectorOfVectors(benchmark::State &state) {
+        auto points = MakePoints(Input(static_cast<std::size_t>(state.range(0)) * 8,
+                                       Distribution::kRandom));
+        std::size_t n = static_cast<std::size_t>(state.range(0));
+        for (auto _ : state) {
+            std::vector<std::vector<Vector>> shapes;
+            for (std::size_t i = 0; i < n; ++i) {
+                shapes.emplace_back(points.begin() + i * 8, points.begin() + i * 8 + ShapeSize(i));
+            }
+            benchmark::DoNotOptimize(shapes.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Одно хранилище, очищаемое между пакетами: после первого пакета без выделений.
+    void BM_BuildGeometryStore(benchmark::State &state) {
+        auto points = MakePoints(Input(static_cast<std::size_t>(state.range(0)) * 8,
+                                       Distribution::kRandom));
+        std::size_t n = static_cast<std::size_t>(state.range(0));
+        olymp_geometry::GeometryStore store;
+        for (auto _ : state) {
+            store.Clear();
+            for (std::size_t i = 0; i < n; ++i) {
+                store.Add(points.begin() + i * 8, points.begin() + i * 8 + ShapeSize(i));
+            }
+            benchmark::DoNotOptimize(store.Vertices().data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Новое хранилище на каждый пакет поверх арены, которая освобождается целиком. Рост
+    // вектора в монотонной арене не возвращает старые блоки, поэтому ёмкость резервируется
+    // заранее.
+    void BM_BuildGeometryStoreArena(benchmark::State &state) {
+        auto points = MakePoints(Input(static_cast<std::size_t>(state.range(0)) * 8,
+                                       Distribution::kRandom));
+        std::size_t n = static_cast<std::size_t>(state.range(0));
+        for (auto _ : state) {
+            std::pmr::monotonic_buffer_resource arena;
+            olymp_geometry::GeometryStore store(&arena);
+            store.Reserve(n, n * 8);
+            for (std::size_t i = 0; i < n; ++i) {
+                store.Add(points.begin() + i * 8, points.begin() + i * 8 + ShapeSize(i));
+            }
+            benchmark::DoNotOptimize(store.Vertices().data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_BuildVectorOfVectors)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
+BENCHMARK(BM_BuildGeometryStore)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
+BENCHMARK(BM_BuildGeometryStoreArena)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "half-plane.h"
+
+namespace {
+    using Line = olymp_geometry::BasicLine<double>;
+    using Vector = olymp_geometry::BasicVector<double>;
+
+    // Касательные к эллипсу в случайном порядке: каждая прямая - сторона ответа.
+    std::vector<Line> MakeTangents(std::size_t n) {
+        std::vector<Line> lines;
+        for (std::size_t i = 0; i < n; ++i) {
+            double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+            lines.emplace_back(-std::cos(angle) / 1e6, -std::sin(angle) / 3e5, 1.0);
+        }
+        std::shuffle(lines.begin(), lines.end(), std::mt19937(1));
+        return lines;
+    }
+
+    void BM_HalfPlaneIntersection(benchmark::State &state) {
+        auto lines = MakeTangents(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::HalfPlaneIntersection(lines));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lines.size()));
+    }
+
+    // Прежний способ: квадрат отсекается каждой полуплоскостью по очереди, O(n^2).
+    void BM_SequentialClipping(benchmark::State &state) {
+        auto lines = MakeTangents(state.range(0));
+        for (auto _ : state) {
+            std::vector<Vector> polygon = {{-1e9, -1e9}, {1e9, -1e9}, {1e9, 1e9}, {-1e9, 1e9}};
+            std::vector<Vector> clipped;
+            for (const Line &line : lines) {
+                clipped.clear();
+                for (std::size_t i = 0; i < polygon.size(); ++i) {
+                    const Vector &a = polygon[i], &b = polygon[(i + 1) % polygon.size()];
+                    double va = line.A_ * a.x_ + line.B_ * a.y_ + line.C_;
+                    double vb = line.A_ * b.x_ + line.B_ * b.y_ + line.C_;
+                    if (va >= 0) {
+                        clipped.push_back(a);
+                    }
+                    if ((va >= 0) != (vb >= 0)) {
+                        double t = va / (va - vb);
+                        clipped.emplace_back(a.x_ + (b.x_ - a.x_) * t, a.y_ + (b.y_ - a.y_) * t);
+                    }
+                }
+                std::swap(polygon, clipped);
+            }
+            benchmark::DoNotOptimize(polygon);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lines.size()));
+    }
+}
+
+BENCHMARK(BM_HalfPlaneIntersection)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
+BENCHMARK(BM_SequentialClipping)->RangeMultiplier(10)->Range(10, 10'000)->ArgName("n");
@@ -0,0 +1,140 @@
+#ifndef OLYMP_GEOMETRY_BENCHMARKS_INPUTS_H
+#define OLYMP_GEOMETRY_BENCHMARKS_INPUTS_H
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "olymp-geometry.h"
+
+namespace olymp_geometry {
+    namespace bench {
+        /*!
+        Распределения входных данных, на которых гоняются все бенчмарки.
+        */
+        enum class Distribution {
+            //! Координаты равномерно в [-1000, 1000]
+            kRandom,
+            //! Отрезки нулевой длины, много совпадающих точек
+            kDegenerate,
+            //! Все точки и отрезки лежат на одной прямой y = x / 2 + 3
+            kCollinear
+        };
+
+        inline const char *DistributionName(Distribution distribution) {
+            switch (distribution) {
+                case Distribution::kRandom:
+                    return "random";
+                case Distribution::kDegenerate:
+                    return "degenerate";
+                case Distribution::kCollinear:
+                    return "collinear";
+            }
+            return "";
+        }
+
+        /*!
+        Размер и распределение из аргументов бенчмарка, см. AllInputs.
+        */
+        struct Input {
+            std::size_t size_;
+            Distribution distribution_;
+
+            explicit Input(benchmark::State &state)
+                : size_(static_cast<std::size_t>(state.range(0))),
+                  distribution_(static_cast<Distribution>(state.range(1))) {
+                state.SetLabel(DistributionName(distribution_));
+            }
+
+            Input(std::size_t size, Distribution distribution)
+                : size_(size), distribution_(distribution) {
+            }
+        };
+
+        /*!
+        Размеры от 10 до 10^7 через порядок для каждого распределения.
+        */
+        inline void AllInputs(benchmark::internal::Benchmark *b) {
+            b->ArgsProduct({benchmark::CreateRange(10, 10'000'000, 10), {0, 1, 2}})
+                    ->ArgNames({"n", "distribution"});
+        }
+
+        inline std::vector<BasicVector<double>> MakePoints(const Input &input,
+                                                           uint64_t seed = 1) {
+            std::mt19937_64 random(seed);
+            std::uniform_real_distribution<double> coordinate(-1000, 1000);
+            std::vector<BasicVector<double>> points(input.size_);
+            for (BasicVector<double> &p : points) {
+                switch (input.distribution_) {
+                    case Distribution::kRandom:
+                        p = {coordinate(random), coordinate(random)};
+                        break;
+                    case Distribution::kDegenerate:
+                        // Всего 16 различных точек.
+                        p = {static_cast<double>(random() % 4), static_cast<double>(random() % 4)};
+                        break;
+                    case Distribution::kCollinear: {
+                        double x = coordinate(random);
+                        p = {x, x / 2 + 3};
+                        break;
+                    }
+                }
+            }
+            return points;
+        }
+
+        inline std::vector<BasicSegment<double>> MakeSegments(const Input &input,
+                                                              uint64_t seed = 2) {
+            std::vector<BasicVector<double>> ends = MakePoints(input, seed);
+            std::vector<BasicVector<double>> others = MakePoints(input, seed + 1);
+            std::vector<BasicSegment<double>> segments(input.size_);
+            for (std::size_t i = 0; i < input.size_; ++i) {
+                segments[i] = {ends[i],
+                               input.distribution_ == Distribution::kDegenerate ? ends[i]
+                                                                                : others[i]};
+            }
+            return segments;
+        }
+
+        template <typename T>
+        std::vector<BasicLine<T>> MakeLines(const std::vector<BasicSegment<T>> &segments) {
+            std::vector<BasicLine<T>> lines;
+            lines.reserve(segments.size());
+            for (const BasicSegment<T> &s : segments) {
+                lines.emplace_back(s.a_, s.b_);
+            }
+            return lines;
+        }
+
+        template <typename T>
+        std::vector<BasicBeam<T>> MakeBeams(const std::vector<BasicSegment<T>> &segments) {
+            std::vector<BasicBeam<T>> beams;
+            beams.reserve(segments.size());
+            for (const BasicSegment<T> &s : segments) {
+                beams.emplace_back(s.a_, s.b_);
+            }
+            return beams;
+        }
+
+        /*!
+        Применяет function к парам (first[i], second[i + 1]) по кругу, так что один массив
+        можно передать дважды, не удваивая память на 10^7 элементах.
+        */
+        template <typename First, typename Second, typename Function>
+        void Pairwise(benchmark::State &state, const std::vector<First> &first,
+                      const std::vector<Second> &second, Function function) {
+            std::size_t n = first.size();
+            for (auto _ : state) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    benchmark::DoNotOptimize(function(first[i], second[i + 1 == n ? 0 : i + 1]));
+                }
+            }
+            state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+        }
+    }
+}
+
+#endif //OLYMP_GEOMETRY_BENCHMARKS_INPUTS_H
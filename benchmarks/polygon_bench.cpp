@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "inputs.h"
+#include "polygon.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Polygon = olymp_geometry::BasicPolygon<double>;
+
+    // Правильный многоугольник на 256 вершин и такая же звезда с вершинами на двух
+    // радиусах: запросы из MakePoints попадают и внутрь, и наружу.
+    Polygon MakePolygon(bool convex) {
+        std::vector<Vector> vertices;
+        for (int i = 0; i < 256; ++i) {
+            double angle = 2 * M_PI * i / 256, radius = convex || i % 2 == 0 ? 800 : 400;
+            vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+        }
+        return Polygon(vertices);
+    }
+
+    void ContainsEach(benchmark::State &state, bool convex) {
+        Polygon polygon = MakePolygon(convex);
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            for (const Vector &v : points) {
+                benchmark::DoNotOptimize(olymp_geometry::Contains(polygon, v));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    void ContainsBatch(benchmark::State &state, bool convex) {
+        Polygon polygon = MakePolygon(convex);
+        olymp_geometry::BasicPointCloud<double> points(MakePoints(Input(state)));
+        std::unique_ptr<bool[]> out(new bool[points.Size()]);
+        for (auto _ : state) {
+            olymp_geometry::Contains(polygon, points, out.get());
+            benchmark::DoNotOptimize(out.get());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.Size()));
+    }
+
+    void BM_ContainsConvex(benchmark::State &state) {
+        ContainsEach(state, true);
+    }
+
+    void BM_ContainsStar(benchmark::State &state) {
+        ContainsEach(state, false);
+    }
+
+    void BM_ContainsConvexBatch(benchmark::State &state) {
+        ContainsBatch(state, true);
+    }
+
+    void BM_ContainsStarBatch(benchmark::State &state) {
+        ContainsBatch(state, false);
+    }
+}
+
+BENCHMARK(BM_ContainsConvex)->Apply(AllInputs);
+BENCHMARK(BM_ContainsStar)->Apply(AllInputs);
+BENCHMARK(BM_ContainsConvexBatch)->Apply(AllInputs);
+BENCHMARK(BM_ContainsStarBatch)->Apply(AllInputs);
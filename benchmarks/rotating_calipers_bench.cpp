@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "rotating-calipers.h"
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+
+    // Калиперам нужен выпуклый многоугольник: n вершин на эллипсе, чтобы все рёбра
+    // были разной длины.
+    std::vector<Vector> MakeConvexPolygon(std::size_t n) {
+        std::vector<Vector> polygon;
+        for (std::size_t i = 0; i < n; ++i) {
+            double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+            polygon.emplace_back(1e6 * std::cos(angle), 3e5 * std::sin(angle));
+        }
+        return polygon;
+    }
+
+    void BM_CalipersDiameter(benchmark::State &state) {
+        auto hull = MakeConvexPolygon(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::Diameter(hull));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * hull.size()));
+    }
+
+    // Перебор всех пар вершин, O(n^2).
+    void BM_BruteForceDiameter(benchmark::State &state) {
+        auto hull = MakeConvexPolygon(state.range(0));
+        for (auto _ : state) {
+            double best = 0;
+            for (const Vector &a : hull) {
+                for (const Vector &b : hull) {
+                    best = std::max(best, olymp_geometry::DistSquared(a, b));
+                }
+            }
+            benchmark::DoNotOptimize(best);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * hull.size()));
+    }
+
+    void BM_CalipersWidth(benchmark::State &state) {
+        auto hull = MakeConvexPolygon(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::Width(hull));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * hull.size()));
+    }
+
+    void BM_CalipersMinAreaRectangle(benchmark::State &state) {
+        auto hull = MakeConvexPolygon(state.range(0));
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(olymp_geometry::MinAreaRectangle(hull));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * hull.size()));
+    }
+
+    // Для каждого ребра проекции всех вершин на ребро и на нормаль к нему, O(n^2).
+    void BM_BruteForceMinAreaRectangle(benchmark::State &state) {
+        auto hull = MakeConvexPolygon(state.range(0));
+        std::size_t n = hull.size();
+        for (auto _ : state) {
+            double best = std::numeric_limits<double>::infinity();
+            for (std::size_t i = 0; i < n; ++i) {
+                Vector edge = hull[i + 1 == n ? 0 : i + 1] - hull[i];
+                double low = 0, high = 0, up = 0;
+                for (const Vector &p : hull) {
+                    double along = olymp_geometry::ScalarMultiplication(edge, p - hull[i]);
+                    low = std::min(low, along);
+                    high = std::max(high, along);
+                    up = std::max(up, olymp_geometry::VectorMultiplication(edge, p - hull[i]));
+                }
+                best = std::min(best, (high - low) * up /
+                                              olymp_geometry::ScalarMultiplication(edge, edge));
+            }
+            benchmark::DoNotOptimize(best);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+}
+
+BENCHMARK(BM_CalipersDiameter)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
+BENCHMARK(BM_BruteForceDiameter)->RangeMultiplier(10)->Range(10, 10'000)->ArgName("n");
+BENCHMARK(BM_CalipersWidth)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
+BENCHMARK(BM_CalipersMinAreaRectangle)->RangeMultiplier(10)->Range(10, 1'000'000)->ArgName("n");
+BENCHMARK(BM_BruteForceMinAreaRectangle)->RangeMultiplier(10)->Range(10, 10'000)->ArgName("n");
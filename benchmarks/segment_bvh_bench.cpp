@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <vector>
+
+#include "inputs.h"
+#include "segment-bvh.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+using olymp_geometry::bench::MakeSegments;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Segment = olymp_geometry::BasicSegment<double>;
+    using SegmentBvh = olymp_geometry::BasicSegmentBvh<double>;
+
+    constexpr std::size_t kQueries = 1000;
+
+    std::vector<Vector> MakeQueries(const Input &input) {
+        return MakePoints(Input(kQueries, input.distribution_), 99);
+    }
+
+    // Короткие отрезки: у случайных отрезков длиной порядка всей области прямоугольники
+    // перекрываются, и никакой индекс не помогает.
+    std::vector<Segment> MakeShortSegments(const Input &input) {
+        std::vector<Segment> segments = MakeSegments(input);
+        for (Segment &s : segments) {
+            s.b_ = {s.a_.x_ + (s.b_.x_ - s.a_.x_) / 100, s.a_.y_ + (s.b_.y_ - s.a_.y_) / 100};
+        }
+        return segments;
+    }
+
+    void BM_NearestSegmentLinearScan(benchmark::State &state) {
+        Input input(state);
+        auto segments = MakeShortSegments(input);
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            for (const Vector &v : queries) {
+                double best = std::numeric_limits<double>::infinity();
+                for (const Segment &s : segments) {
+                    best = std::min(best, olymp_geometry::DistSquared(s, v));
+                }
+                benchmark::DoNotOptimize(best);
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+
+    void BM_SegmentBvhBuild(benchmark::State &state) {
+        auto segments = MakeShortSegments(Input(state));
+        for (auto _ : state) {
+            SegmentBvh bvh(segments);
+            benchmark::DoNotOptimize(bvh.Size());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * segments.size()));
+    }
+
+    void BM_SegmentBvhNearest(benchmark::State &state) {
+        Input input(state);
+        SegmentBvh bvh(MakeShortSegments(input));
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            for (const Vector &v : queries) {
+                benchmark::DoNotOptimize(bvh.Nearest(v));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+
+    void BM_SegmentBvhNearestBatch(benchmark::State &state) {
+        Input input(state);
+        SegmentBvh bvh(MakeShortSegments(input));
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(bvh.Nearest(queries));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+
+    void BM_SegmentBvhWithinDistance(benchmark::State &state) {
+        Input input(state);
+        SegmentBvh bvh(MakeShortSegments(input));
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            for (const Vector &v : queries) {
+                benchmark::DoNotOptimize(bvh.WithinDistance(v, 10));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+
+    void BM_SegmentBvhIntersecting(benchmark::State &state) {
+        Input input(state);
+        SegmentBvh bvh(MakeShortSegments(input));
+        auto queries = MakeShortSegments(Input(kQueries, input.distribution_));
+        for (auto _ : state) {
+            for (const Segment &s : queries) {
+                benchmark::DoNotOptimize(bvh.Intersecting(s));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+}
+
+// Линейный просмотр на 10^7 отрезков и 1000 запросов занимает минуты.
+BENCHMARK(BM_NearestSegmentLinearScan)
+        ->ArgsProduct({benchmark::CreateRange(10, 100'000, 10), {0, 1, 2}})
+        ->ArgNames({"n", "distribution"});
+BENCHMARK(BM_SegmentBvhBuild)->Apply(AllInputs);
+BENCHMARK(BM_SegmentBvhNearest)->Apply(AllInputs);
+BENCHMARK(BM_SegmentBvhNearestBatch)->Apply(AllInputs);
+BENCHMARK(BM_SegmentBvhWithinDistance)->Apply(AllInputs);
+BENCHMARK(BM_SegmentBvhIntersecting)->Apply(AllInputs);
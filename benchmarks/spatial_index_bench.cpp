@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <vector>
+
+#include "inputs.h"
+#include "spatial-index.h"
+
+using olymp_geometry::bench::AllInputs;
+using olymp_geometry::bench::Input;
+using olymp_geometry::bench::MakePoints;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+
+    constexpr std::size_t kQueries = 1000;
+
+    std::vector<Vector> MakeQueries(const Input &input) {
+        return MakePoints(Input(kQueries, input.distribution_), 99);
+    }
+
+    void BM_NearestLinearScan(benchmark::State &state) {
+        Input input(state);
+        auto points = MakePoints(input);
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            for (const Vector &v : queries) {
+                double best = std::numeric_limits<double>::infinity();
+                for (const Vector &p : points) {
+                    best = std::min(best, olymp_geometry::DistSquared(p, v));
+                }
+                benchmark::DoNotOptimize(best);
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+
+    template <typename Index>
+    void BM_Build(benchmark::State &state) {
+        auto points = MakePoints(Input(state));
+        for (auto _ : state) {
+            Index index(points);
+            benchmark::DoNotOptimize(index.Size());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * points.size()));
+    }
+
+    template <typename Index>
+    void BM_Nearest(benchmark::State &state) {
+        Input input(state);
+        Index index(MakePoints(input));
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            for (const Vector &v : queries) {
+                benchmark::DoNotOptimize(index.Nearest(v));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+
+    template <typename Index>
+    void BM_KNearest(benchmark::State &state) {
+        Input input(state);
+        Index index(MakePoints(input));
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            for (const Vector &v : queries) {
+                benchmark::DoNotOptimize(index.KNearest(v, 8));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+
+    template <typename Index>
+    void BM_Radius(benchmark::State &state) {
+        Input input(state);
+        Index index(MakePoints(input));
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            for (const Vector &v : queries) {
+                benchmark::DoNotOptimize(index.Radius(v, 10));
+            }
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+
+    template <typename Index>
+    void BM_NearestBatch(benchmark::State &state) {
+        Input input(state);
+        Index index(MakePoints(input));
+        auto queries = MakeQueries(input);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(index.Nearest(queries));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kQueries));
+    }
+}
+
+using KdTree = olymp_geometry::BasicKdTree<double>;
+using UniformGrid = olymp_geometry::BasicUniformGrid<double>;
+
+// Линейный просмотр на 10^7 точек и 1000 запросов занимает минуты.
+BENCHMARK(BM_NearestLinearScan)
+        ->ArgsProduct({benchmark::CreateRange(10, 100'000, 10), {0, 1, 2}})
+        ->ArgNames({"n", "distribution"});
+BENCHMARK_TEMPLATE(BM_Build, KdTree)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_Build, UniformGrid)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_Nearest, KdTree)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_Nearest, UniformGrid)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_KNearest, KdTree)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_KNearest, UniformGrid)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_Radius, KdTree)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_Radius, UniformGrid)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_NearestBatch, KdTree)->Apply(AllInputs);
+BENCHMARK_TEMPLATE(BM_NearestBatch, UniformGrid)->Apply(AllInputs);
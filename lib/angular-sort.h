@@ -0,0 +1,67 @@
+#ifndef OLYMP_GEOMETRY_ANGULAR_SORT_H
+#define OLYMP_GEOMETRY_ANGULAR_SORT_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "parallel.h"
+
+namespace olymp_geometry {
+    namespace detail {
+        // Номер четверти точки p относительно origin: 0 для p == origin, затем 1-4 для углов
+        // [0, pi/2), [pi/2, pi), [pi, 3pi/2), [3pi/2, 2pi). Координаты сравниваются, а не
+        // вычитаются, поэтому границы четвертей точные.
+        template <typename T>
+        int Quadrant(const BasicVector<T> &p, const BasicVector<T> &origin) {
+            if (p.x_ > origin.x_ && p.y_ >= origin.y_) {
+                return 1;
+            } else if (p.x_ <= origin.x_ && p.y_ > origin.y_) {
+                return 2;
+            } else if (p.x_ < origin.x_ && p.y_ <= origin.y_) {
+                return 3;
+            } else if (p.x_ >= origin.x_ && p.y_ < origin.y_) {
+                return 4;
+            }
+            return 0;
+        }
+    }
+
+    /*!
+    \ingroup angles
+    Сортирует точки по полярному углу вокруг origin, как AngleLess(p - origin, q - origin),
+    но без вычитания: повороты считаются точным Orient2D. Точки сначала раскладываются
+    по четвертям одним проходом подсчётом, как в поразрядной сортировке. Внутри четверти
+    углы отличаются меньше чем на pi/2, так что достаточно одного Orient2D на сравнение, а
+    большие четверти сортируются в GetThreadCount() потоках.
+    \param[in,out] points Точки. Совпадающие с origin идут первыми, порядок точек на одном
+    луче из origin не определён
+    \param[in] origin Центр
+    */
+    template <typename T>
+    void SortByAngle(std::vector<BasicVector<T>> &points,
+                     const BasicVector<T> &origin = BasicVector<T>(0, 0)) {
+        std::array<std::size_t, 6> start{};
+        for (const BasicVector<T> &p : points) {
+            ++start[detail::Quadrant(p, origin) + 1];
+        }
+        for (std::size_t q = 1; q < start.size(); ++q) {
+            start[q] += start[q - 1];
+        }
+        std::vector<BasicVector<T>> sorted(points.size());
+        std::array<std::size_t, 6> next = start;
+        for (const BasicVector<T> &p : points) {
+            sorted[next[detail::Quadrant(p, origin)]++] = p;
+        }
+        auto less = [&origin](const BasicVector<T> &a, const BasicVector<T> &b) {
+            return Orient2D(origin, a, b) > 0;
+        };
+        for (std::size_t q = 1; q <= 4; ++q) {
+            detail::ParallelSort(sorted.begin() + start[q], sorted.begin() + start[q + 1], less);
+        }
+        points = std::move(sorted);
+    }
+}
+
+#endif //OLYMP_GEOMETRY_ANGULAR_SORT_H
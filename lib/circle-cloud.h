@@ -0,0 +1,607 @@
+#ifndef OLYMP_GEOMETRY_CIRCLE_CLOUD_H
+#define OLYMP_GEOMETRY_CIRCLE_CLOUD_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "segment-cloud.h"
+#include "simd.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Набор кругов в виде структуры массивов: координаты центров и радиусы лежат в
+    трёх отдельных выровненных массивах.
+    \tparam T Тип координат. Векторные ядра есть для double.
+    */
+    template <typename T>
+    class BasicCircleCloud {
+    public:
+        BasicCircleCloud() = default;
+
+        explicit BasicCircleCloud(const std::vector<BasicCircle<T>> &circles) {
+            Reserve(circles.size());
+            for (const BasicCircle<T> &c : circles) {
+                PushBack(c);
+            }
+        }
+
+        std::size_t Size() const {
+            return x_.size();
+        }
+
+        bool Empty() const {
+            return x_.empty();
+        }
+
+        void Reserve(std::size_t size) {
+            x_.reserve(size);
+            y_.reserve(size);
+            r_.reserve(size);
+        }
+
+        void Clear() {
+            x_.clear();
+            y_.clear();
+            r_.clear();
+        }
+
+        void PushBack(const BasicCircle<T> &c) {
+            x_.push_back(c.center_.x_);
+            y_.push_back(c.center_.y_);
+            r_.push_back(c.radius_);
+        }
+
+        BasicCircle<T> operator[](std::size_t i) const {
+            return {{x_[i], y_[i]}, r_[i]};
+        }
+
+        const T *X() const {
+            return x_.data();
+        }
+
+        const T *Y() const {
+            return y_.data();
+        }
+
+        const T *R() const {
+            return r_.data();
+        }
+
+    private:
+        std::vector<T, detail::AlignedAllocator<T>> x_, y_, r_;
+    };
+
+    using CircleCloud = BasicCircleCloud<double>;
+
+    namespace detail {
+#if OLYMP_GEOMETRY_X86_SIMD
+        // Ядра повторяют SegmentHitsDisk и проверку Intersect(circle, line) операция в
+        // операцию и без FMA, поэтому ответ совпадает со скалярным побитово. Ядра
+        // расстояний считают с FMA там, где она есть.
+
+        // Биты отрезков [0, count), задевающих круг (cx, cy) с квадратом радиуса limit.
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline uint64_t SegmentDiskSse2(double cx, double cy, double limit, const double *ax,
+                                        const double *ay, const double *bx, const double *by,
+                                        std::size_t count) {
+            const __m128d vcx = _mm_set1_pd(cx), vcy = _mm_set1_pd(cy);
+            const __m128d vlimit = _mm_set1_pd(limit), zero = _mm_setzero_pd();
+            uint64_t bits = 0;
+            for (std::size_t k = 0; k + 2 <= count; k += 2) {
+                __m128d vax = _mm_loadu_pd(ax + k), vay = _mm_loadu_pd(ay + k);
+                __m128d vbx = _mm_loadu_pd(bx + k), vby = _mm_loadu_pd(by + k);
+                __m128d dx = _mm_sub_pd(vbx, vax), dy = _mm_sub_pd(vby, vay);
+                __m128d fx = _mm_sub_pd(vcx, vax), fy = _mm_sub_pd(vcy, vay);
+                __m128d gx = _mm_sub_pd(vcx, vbx), gy = _mm_sub_pd(vcy, vby);
+                __m128d t = _mm_add_pd(_mm_mul_pd(fx, dx), _mm_mul_pd(fy, dy));
+                __m128d length = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+                __m128d cross = _mm_sub_pd(_mm_mul_pd(dx, fy), _mm_mul_pd(dy, fx));
+                __m128d ends = _mm_or_pd(
+                        _mm_cmple_pd(_mm_add_pd(_mm_mul_pd(fx, fx), _mm_mul_pd(fy, fy)), vlimit),
+                        _mm_cmple_pd(_mm_add_pd(_mm_mul_pd(gx, gx), _mm_mul_pd(gy, gy)), vlimit));
+                __m128d inside = _mm_and_pd(
+                        _mm_and_pd(_mm_cmpgt_pd(t, zero), _mm_cmplt_pd(t, length)),
+                        _mm_cmple_pd(_mm_mul_pd(cross, cross), _mm_mul_pd(vlimit, length)));
+                bits |= static_cast<uint64_t>(_mm_movemask_pd(_mm_or_pd(ends, inside))) << k;
+            }
+            return bits;
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline uint64_t SegmentDiskAvx2(double cx, double cy, double limit, const double *ax,
+                                        const double *ay, const double *bx, const double *by,
+                                        std::size_t count) {
+            const __m256d vcx = _mm256_set1_pd(cx), vcy = _mm256_set1_pd(cy);
+            const __m256d vlimit = _mm256_set1_pd(limit), zero = _mm256_setzero_pd();
+            uint64_t bits = 0;
+            for (std::size_t k = 0; k + 4 <= count; k += 4) {
+                __m256d vax = _mm256_loadu_pd(ax + k), vay = _mm256_loadu_pd(ay + k);
+                __m256d vbx = _mm256_loadu_pd(bx + k), vby = _mm256_loadu_pd(by + k);
+                __m256d dx = _mm256_sub_pd(vbx, vax), dy = _mm256_sub_pd(vby, vay);
+                __m256d fx = _mm256_sub_pd(vcx, vax), fy = _mm256_sub_pd(vcy, vay);
+                __m256d gx = _mm256_sub_pd(vcx, vbx), gy = _mm256_sub_pd(vcy, vby);
+                __m256d t = _mm256_add_pd(_mm256_mul_pd(fx, dx), _mm256_mul_pd(fy, dy));
+                __m256d length = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+                __m256d cross = _mm256_sub_pd(_mm256_mul_pd(dx, fy), _mm256_mul_pd(dy, fx));
+                __m256d ff = _mm256_add_pd(_mm256_mul_pd(fx, fx), _mm256_mul_pd(fy, fy));
+                __m256d gg = _mm256_add_pd(_mm256_mul_pd(gx, gx), _mm256_mul_pd(gy, gy));
+                __m256d ends = _mm256_or_pd(_mm256_cmp_pd(ff, vlimit, _CMP_LE_OQ),
+                                            _mm256_cmp_pd(gg, vlimit, _CMP_LE_OQ));
+                __m256d inside = _mm256_and_pd(
+                        _mm256_and_pd(_mm256_cmp_pd(t, zero, _CMP_GT_OQ),
+                                      _mm256_cmp_pd(t, length, _CMP_LT_OQ)),
+                        _mm256_cmp_pd(_mm256_mul_pd(cross, cross), _mm256_mul_pd(vlimit, length),
+                                      _CMP_LE_OQ));
+                bits |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_or_pd(ends, inside)))
+                        << k;
+            }
+            return bits;
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline uint64_t SegmentDiskAvx512(double cx, double cy, double limit, const double *ax,
+                                          const double *ay, const double *bx, const double *by,
+                                          std::size_t count) {
+            const __m512d vcx = _mm512_set1_pd(cx), vcy = _mm512_set1_pd(cy);
+            const __m512d vlimit = _mm512_set1_pd(limit), zero = _mm512_setzero_pd();
+            uint64_t bits = 0;
+            for (std::size_t k = 0; k + 8 <= count; k += 8) {
+                __m512d vax = _mm512_loadu_pd(ax + k), vay = _mm512_loadu_pd(ay + k);
+                __m512d vbx = _mm512_loadu_pd(bx + k), vby = _mm512_loadu_pd(by + k);
+                __m512d dx = _mm512_sub_pd(vbx, vax), dy = _mm512_sub_pd(vby, vay);
+                __m512d fx = _mm512_sub_pd(vcx, vax), fy = _mm512_sub_pd(vcy, vay);
+                __m512d gx = _mm512_sub_pd(vcx, vbx), gy = _mm512_sub_pd(vcy, vby);
+                __m512d t = _mm512_add_pd(_mm512_mul_pd(fx, dx), _mm512_mul_pd(fy, dy));
+                __m512d length = _mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy));
+                __m512d cross = _mm512_sub_pd(_mm512_mul_pd(dx, fy), _mm512_mul_pd(dy, fx));
+                __m512d ff = _mm512_add_pd(_mm512_mul_pd(fx, fx), _mm512_mul_pd(fy, fy));
+                __m512d gg = _mm512_add_pd(_mm512_mul_pd(gx, gx), _mm512_mul_pd(gy, gy));
+                __mmask8 ends = _mm512_cmp_pd_mask(ff, vlimit, _CMP_LE_OQ) |
+                                _mm512_cmp_pd_mask(gg, vlimit, _CMP_LE_OQ);
+                __mmask8 inside = _mm512_cmp_pd_mask(t, zero, _CMP_GT_OQ) &
+                                  _mm512_cmp_pd_mask(t, length, _CMP_LT_OQ) &
+                                  _mm512_cmp_pd_mask(_mm512_mul_pd(cross, cross),
+                                                     _mm512_mul_pd(vlimit, length), _CMP_LE_OQ);
+                bits |= static_cast<uint64_t>(ends | inside) << k;
+            }
+            return bits;
+        }
+
+        // Биты кругов [0, count), через которые проходит прямая: (A*x + B*y + C)^2 <=
+        // (r + eps)^2 * norm.
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline uint64_t LineDiskSse2(double a, double b, double c, double norm, double eps,
+                                     const double *x, const double *y, const double *r,
+                                     std::size_t count) {
+            const __m128d va = _mm_set1_pd(a), vb = _mm_set1_pd(b), vc = _mm_set1_pd(c);
+            const __m128d vnorm = _mm_set1_pd(norm), veps = _mm_set1_pd(eps);
+            uint64_t bits = 0;
+            for (std::size_t k = 0; k + 2 <= count; k += 2) {
+                __m128d value = _mm_add_pd(_mm_add_pd(_mm_mul_pd(va, _mm_loadu_pd(x + k)),
+                                                      _mm_mul_pd(vb, _mm_loadu_pd(y + k))),
+                                           vc);
+                __m128d radius = _mm_add_pd(_mm_loadu_pd(r + k), veps);
+                __m128d hit = _mm_cmple_pd(_mm_mul_pd(value, value),
+                                           _mm_mul_pd(_mm_mul_pd(radius, radius), vnorm));
+                bits |= static_cast<uint64_t>(_mm_movemask_pd(hit)) << k;
+            }
+            return bits;
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline uint64_t LineDiskAvx2(double a, double b, double c, double norm, double eps,
+                                     const double *x, const double *y, const double *r,
+                                     std::size_t count) {
+            const __m256d va = _mm256_set1_pd(a), vb = _mm256_set1_pd(b), vc = _mm256_set1_pd(c);
+            const __m256d vnorm = _mm256_set1_pd(norm), veps = _mm256_set1_pd(eps);
+            uint64_t bits = 0;
+            for (std::size_t k = 0; k + 4 <= count; k += 4) {
+                __m256d value = _mm256_add_pd(
+                        _mm256_add_pd(_mm256_mul_pd(va, _mm256_loadu_pd(x + k)),
+                                      _mm256_mul_pd(vb, _mm256_loadu_pd(y + k))),
+                        vc);
+                __m256d radius = _mm256_add_pd(_mm256_loadu_pd(r + k), veps);
+                __m256d hit = _mm256_cmp_pd(_mm256_mul_pd(value, value),
+                                            _mm256_mul_pd(_mm256_mul_pd(radius, radius), vnorm),
+                                            _CMP_LE_OQ);
+                bits |= static_cast<uint64_t>(_mm256_movemask_pd(hit)) << k;
+            }
+            return bits;
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline uint64_t LineDiskAvx512(double a, double b, double c, double norm, double eps,
+                                       const double *x, const double *y, const double *r,
+                                       std::size_t count) {
+            const __m512d va = _mm512_set1_pd(a), vb = _mm512_set1_pd(b), vc = _mm512_set1_pd(c);
+            const __m512d vnorm = _mm512_set1_pd(norm), veps = _mm512_set1_pd(eps);
+            uint64_t bits = 0;
+            for (std::size_t k = 0; k + 8 <= count; k += 8) {
+                __m512d value = _mm512_add_pd(
+                        _mm512_add_pd(_mm512_mul_pd(va, _mm512_loadu_pd(x + k)),
+                                      _mm512_mul_pd(vb, _mm512_loadu_pd(y + k))),
+                        vc);
+                __m512d radius = _mm512_add_pd(_mm512_loadu_pd(r + k), veps);
+                __mmask8 hit = _mm512_cmp_pd_mask(
+                        _mm512_mul_pd(value, value),
+                        _mm512_mul_pd(_mm512_mul_pd(radius, radius), vnorm), _CMP_LE_OQ);
+                bits |= static_cast<uint64_t>(hit) << k;
+            }
+            return bits;
+        }
+
+        // max(0, sqrt(d) - r), где d - квадрат расстояния от центра до отрезка: квадрат
+        // расстояния до ближайшего конца или cross^2 / |b - a|^2.
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline void SegmentDiskDistSse2(double cx, double cy, double r, const double *ax,
+                                        const double *ay, const double *bx, const double *by,
+                                        std::size_t n, double *out) {
+            const __m128d vcx = _mm_set1_pd(cx), vcy = _mm_set1_pd(cy), vr = _mm_set1_pd(r);
+            const __m128d zero = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                __m128d vax = _mm_loadu_pd(ax + i), vay = _mm_loadu_pd(ay + i);
+                __m128d vbx = _mm_loadu_pd(bx + i), vby = _mm_loadu_pd(by + i);
+                __m128d dx = _mm_sub_pd(vbx, vax), dy = _mm_sub_pd(vby, vay);
+                __m128d fx = _mm_sub_pd(vcx, vax), fy = _mm_sub_pd(vcy, vay);
+                __m128d gx = _mm_sub_pd(vcx, vbx), gy = _mm_sub_pd(vcy, vby);
+                __m128d t = _mm_add_pd(_mm_mul_pd(fx, dx), _mm_mul_pd(fy, dy));
+                __m128d length = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+                __m128d cross = _mm_sub_pd(_mm_mul_pd(dx, fy), _mm_mul_pd(dy, fx));
+                __m128d ff = _mm_add_pd(_mm_mul_pd(fx, fx), _mm_mul_pd(fy, fy));
+                __m128d gg = _mm_add_pd(_mm_mul_pd(gx, gx), _mm_mul_pd(gy, gy));
+                __m128d middle = _mm_div_pd(_mm_mul_pd(cross, cross), length);
+                __m128d before = _mm_cmple_pd(t, zero);
+                __m128d after = _mm_andnot_pd(before, _mm_cmpge_pd(t, length));
+                __m128d squared = _mm_or_pd(
+                        _mm_or_pd(_mm_and_pd(before, ff), _mm_and_pd(after, gg)),
+                        _mm_andnot_pd(_mm_or_pd(before, after), middle));
+                _mm_storeu_pd(out + i, _mm_max_pd(zero, _mm_sub_pd(_mm_sqrt_pd(squared), vr)));
+            }
+            for (; i < n; ++i) {
+                out[i] = std::max(0.0, std::sqrt(SegmentDistSquared(cx, cy, ax[i], ay[i], bx[i],
+                                                                    by[i])) - r);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2
+        inline void SegmentDiskDistAvx2(double cx, double cy, double r, const double *ax,
+                                        const double *ay, const double *bx, const double *by,
+                                        std::size_t n, double *out) {
+            const __m256d vcx = _mm256_set1_pd(cx), vcy = _mm256_set1_pd(cy);
+            const __m256d vr = _mm256_set1_pd(r), zero = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256d vax = _mm256_loadu_pd(ax + i), vay = _mm256_loadu_pd(ay + i);
+                __m256d vbx = _mm256_loadu_pd(bx + i), vby = _mm256_loadu_pd(by + i);
+                __m256d dx = _mm256_sub_pd(vbx, vax), dy = _mm256_sub_pd(vby, vay);
+                __m256d fx = _mm256_sub_pd(vcx, vax), fy = _mm256_sub_pd(vcy, vay);
+                __m256d gx = _mm256_sub_pd(vcx, vbx), gy = _mm256_sub_pd(vcy, vby);
+                __m256d t = _mm256_fmadd_pd(fx, dx, _mm256_mul_pd(fy, dy));
+                __m256d length = _mm256_fmadd_pd(dx, dx, _mm256_mul_pd(dy, dy));
+                __m256d cross = _mm256_fmsub_pd(dx, fy, _mm256_mul_pd(dy, fx));
+                __m256d ff = _mm256_fmadd_pd(fx, fx, _mm256_mul_pd(fy, fy));
+                __m256d gg = _mm256_fmadd_pd(gx, gx, _mm256_mul_pd(gy, gy));
+                __m256d middle = _mm256_div_pd(_mm256_mul_pd(cross, cross), length);
+                __m256d squared = _mm256_blendv_pd(
+                        _mm256_blendv_pd(middle, gg, _mm256_cmp_pd(t, length, _CMP_GE_OQ)), ff,
+                        _mm256_cmp_pd(t, zero, _CMP_LE_OQ));
+                __m256d distance = _mm256_sub_pd(_mm256_sqrt_pd(squared), vr);
+                _mm256_storeu_pd(out + i, _mm256_max_pd(zero, distance));
+            }
+            for (; i < n; ++i) {
+                out[i] = std::max(0.0, std::sqrt(SegmentDistSquared(cx, cy, ax[i], ay[i], bx[i],
+                                                                    by[i])) - r);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512
+        inline void SegmentDiskDistAvx512(double cx, double cy, double r, const double *ax,
+                                          const double *ay, const double *bx, const double *by,
+                                          std::size_t n, double *out) {
+            const __m512d vcx = _mm512_set1_pd(cx), vcy = _mm512_set1_pd(cy);
+            const __m512d vr = _mm512_set1_pd(r), zero = _mm512_setzero_pd();
+            for (std::size_t i = 0; i < n; i += 8) {
+                __mmask8 m = n - i >= 8 ? 0xFF : static_cast<__mmask8>((1u << (n - i)) - 1);
+                __m512d vax = _mm512_maskz_loadu_pd(m, ax + i);
+                __m512d vay = _mm512_maskz_loadu_pd(m, ay + i);
+                __m512d vbx = _mm512_maskz_loadu_pd(m, bx + i);
+                __m512d vby = _mm512_maskz_loadu_pd(m, by + i);
+                __m512d dx = _mm512_sub_pd(vbx, vax), dy = _mm512_sub_pd(vby, vay);
+                __m512d fx = _mm512_sub_pd(vcx, vax), fy = _mm512_sub_pd(vcy, vay);
+                __m512d gx = _mm512_sub_pd(vcx, vbx), gy = _mm512_sub_pd(vcy, vby);
+                __m512d t = _mm512_fmadd_pd(fx, dx, _mm512_mul_pd(fy, dy));
+                __m512d length = _mm512_fmadd_pd(dx, dx, _mm512_mul_pd(dy, dy));
+                __m512d cross = _mm512_fmsub_pd(dx, fy, _mm512_mul_pd(dy, fx));
+                __m512d ff = _mm512_fmadd_pd(fx, fx, _mm512_mul_pd(fy, fy));
+                __m512d gg = _mm512_fmadd_pd(gx, gx, _mm512_mul_pd(gy, gy));
+                __m512d squared = _mm512_div_pd(_mm512_mul_pd(cross, cross), length);
+                squared = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(t, length, _CMP_GE_OQ),
+                                               squared, gg);
+                squared = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(t, zero, _CMP_LE_OQ), squared,
+                                               ff);
+                _mm512_mask_storeu_pd(
+                        out + i, m,
+                        _mm512_max_pd(zero, _mm512_sub_pd(_mm512_sqrt_pd(squared), vr)));
+            }
+        }
+
+        // max(0, |A*x + B*y + C| * inv - r) для каждого круга.
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline void LineDiskDistSse2(double a, double b, double c, double inv, const double *x,
+                                     const double *y, const double *r, std::size_t n,
+                                     double *out) {
+            const __m128d va = _mm_set1_pd(a), vb = _mm_set1_pd(b), vc = _mm_set1_pd(c);
+            const __m128d vinv = _mm_set1_pd(inv), sign = _mm_set1_pd(-0.0);
+            const __m128d zero = _mm_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                __m128d v = _mm_add_pd(_mm_add_pd(_mm_mul_pd(va, _mm_loadu_pd(x + i)),
+                                                  _mm_mul_pd(vb, _mm_loadu_pd(y + i))),
+                                       vc);
+                __m128d d = _mm_sub_pd(_mm_mul_pd(_mm_andnot_pd(sign, v), vinv),
+                                       _mm_loadu_pd(r + i));
+                _mm_storeu_pd(out + i, _mm_max_pd(zero, d));
+            }
+            for (; i < n; ++i) {
+                out[i] = std::max(0.0, std::abs(a * x[i] + b * y[i] + c) * inv - r[i]);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2
+        inline void LineDiskDistAvx2(double a, double b, double c, double inv, const double *x,
+                                     const double *y, const double *r, std::size_t n,
+                                     double *out) {
+            const __m256d va = _mm256_set1_pd(a), vb = _mm256_set1_pd(b), vc = _mm256_set1_pd(c);
+            const __m256d vinv = _mm256_set1_pd(inv), sign = _mm256_set1_pd(-0.0);
+            const __m256d zero = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256d v = _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i),
+                                            _mm256_fmadd_pd(vb, _mm256_loadu_pd(y + i), vc));
+                __m256d d = _mm256_fmsub_pd(_mm256_andnot_pd(sign, v), vinv,
+                                            _mm256_loadu_pd(r + i));
+                _mm256_storeu_pd(out + i, _mm256_max_pd(zero, d));
+            }
+            for (; i < n; ++i) {
+                out[i] = std::max(0.0, std::abs(a * x[i] + b * y[i] + c) * inv - r[i]);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512
+        inline void LineDiskDistAvx512(double a, double b, double c, double inv, const double *x,
+                                       const double *y, const double *r, std::size_t n,
+                                       double *out) {
+            const __m512d va = _mm512_set1_pd(a), vb = _mm512_set1_pd(b), vc = _mm512_set1_pd(c);
+            const __m512d vinv = _mm512_set1_pd(inv), zero = _mm512_setzero_pd();
+            for (std::size_t i = 0; i < n; i += 8) {
+                __mmask8 m = n - i >= 8 ? 0xFF : static_cast<__mmask8>((1u << (n - i)) - 1);
+                __m512d v = _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(m, x + i),
+                                            _mm512_fmadd_pd(vb, _mm512_maskz_loadu_pd(m, y + i),
+                                                            vc));
+                __m512d d = _mm512_fmsub_pd(_mm512_abs_pd(v), vinv,
+                                            _mm512_maskz_loadu_pd(m, r + i));
+                _mm512_mask_storeu_pd(out + i, m, _mm512_max_pd(zero, d));
+            }
+        }
+#endif
+
+        // Маска отрезков [begin, begin + count), count <= 64, задевающих круг. Хвост меньше
+        // ширины регистра проверяется через Intersect.
+        template <typename T>
+        uint64_t SegmentDiskChunk(const BasicCircle<T> &circle,
+                                  const BasicSegmentCloud<T> &segments, std::size_t begin,
+                                  std::size_t count) {
+            std::size_t done = 0;
+            uint64_t bits = 0;
+#if OLYMP_GEOMETRY_X86_SIMD
+            if constexpr (std::is_same_v<T, double>) {
+                double cx = circle.center_.x_, cy = circle.center_.y_;
+                double limit = HitRadiusSquared(circle);
+                const double *ax = segments.AX() + begin, *ay = segments.AY() + begin;
+                const double *bx = segments.BX() + begin, *by = segments.BY() + begin;
+                switch (GetSimdLevel()) {
+                    case SimdLevel::kAvx512:
+                        done = count / 8 * 8;
+                        bits = SegmentDiskAvx512(cx, cy, limit, ax, ay, bx, by, count);
+                        break;
+                    case SimdLevel::kAvx2:
+                        done = count / 4 * 4;
+                        bits = SegmentDiskAvx2(cx, cy, limit, ax, ay, bx, by, count);
+                        break;
+                    case SimdLevel::kSse2:
+                        done = count / 2 * 2;
+                        bits = SegmentDiskSse2(cx, cy, limit, ax, ay, bx, by, count);
+                        break;
+                    case SimdLevel::kScalar:
+                        break;
+                }
+            }
+#endif
+            for (std::size_t k = done; k < count; ++k) {
+                if (Intersect(circle, segments[begin + k])) {
+                    bits |= uint64_t{1} << k;
+                }
+            }
+            return bits;
+        }
+
+        // Маска кругов [begin, begin + count), count <= 64, через которые проходит прямая.
+        template <typename T>
+        uint64_t LineDiskChunk(const BasicLine<T> &line, const BasicCircleCloud<T> &circles,
+                               std::size_t begin, std::size_t count) {
+            std::size_t done = 0;
+            uint64_t bits = 0;
+#if OLYMP_GEOMETRY_X86_SIMD
+            if constexpr (std::is_same_v<T, double>) {
+                double norm = line.A_ * line.A_ + line.B_ * line.B_, eps = kEpsOf<T>;
+                const double *x = circles.X() + begin, *y = circles.Y() + begin;
+                const double *r = circles.R() + begin;
+                switch (GetSimdLevel()) {
+                    case SimdLevel::kAvx512:
+                        done = count / 8 * 8;
+                        bits = LineDiskAvx512(line.A_, line.B_, line.C_, norm, eps, x, y, r, count);
+                        break;
+                    case SimdLevel::kAvx2:
+                        done = count / 4 * 4;
+                        bits = LineDiskAvx2(line.A_, line.B_, line.C_, norm, eps, x, y, r, count);
+                        break;
+                    case SimdLevel::kSse2:
+                        done = count / 2 * 2;
+                        bits = LineDiskSse2(line.A_, line.B_, line.C_, norm, eps, x, y, r, count);
+                        break;
+                    case SimdLevel::kScalar:
+                        break;
+                }
+            }
+#endif
+            for (std::size_t k = done; k < count; ++k) {
+                if (Intersect(circles[begin + k], line)) {
+                    bits |= uint64_t{1} << k;
+                }
+            }
+            return bits;
+        }
+    }
+
+    /*!
+    \ingroup circle
+    Проверяет, задевает ли круг каждый отрезок набора, с тем же результатом, что и
+    Intersect(circle, segments[i]). Ядро не извлекает корней и не делит.
+    \param[in] circle Круг
+    \param[in] segments Набор отрезков
+    \param[out] mask Битовая маска: бит i % 64 слова i / 64 равен Intersect(circle,
+    segments[i]). Должна вмещать (segments.Size() + 63) / 64 слов.
+    */
+    template <typename T>
+    void IntersectMask(const BasicCircle<T> &circle, const BasicSegmentCloud<T> &segments,
+                       uint64_t *mask) {
+        for (std::size_t begin = 0; begin < segments.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, segments.Size() - begin);
+            mask[begin / 64] = detail::SegmentDiskChunk(circle, segments, begin, count);
+        }
+    }
+
+    /*!
+    \ingroup circle
+    То же, что и IntersectMask(circle, segments, mask), но пишет ответ в массив bool.
+    \param[out] out out[i] = Intersect(circle, segments[i])
+    */
+    template <typename T>
+    void Intersect(const BasicCircle<T> &circle, const BasicSegmentCloud<T> &segments,
+                   bool *out) {
+        for (std::size_t begin = 0; begin < segments.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, segments.Size() - begin);
+            uint64_t bits = detail::SegmentDiskChunk(circle, segments, begin, count);
+            for (std::size_t k = 0; k < count; ++k) {
+                out[begin + k] = (bits >> k) & 1u;
+            }
+        }
+    }
+
+    /*!
+    \ingroup circle
+    Расстояния от круга до каждого отрезка набора.
+    \param[in] circle Круг
+    \param[in] segments Набор отрезков
+    \param[out] out out[i] = Dist(circle, segments[i])
+    */
+    template <typename T>
+    void Dist(const BasicCircle<T> &circle, const BasicSegmentCloud<T> &segments,
+              RealType<T> *out) {
+        std::size_t n = segments.Size();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            double cx = circle.center_.x_, cy = circle.center_.y_, r = circle.radius_;
+            const double *ax = segments.AX(), *ay = segments.AY();
+            const double *bx = segments.BX(), *by = segments.BY();
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::SegmentDiskDistAvx512(cx, cy, r, ax, ay, bx, by, n, out);
+                case SimdLevel::kAvx2:
+                    return detail::SegmentDiskDistAvx2(cx, cy, r, ax, ay, bx, by, n, out);
+                case SimdLevel::kSse2:
+                    return detail::SegmentDiskDistSse2(cx, cy, r, ax, ay, bx, by, n, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = Dist(circle, segments[i]);
+        }
+    }
+
+    /*!
+    \ingroup circle
+    Проверяет, проходит ли прямая через каждый круг набора, с тем же результатом, что и
+    Intersect(circles[i], line). Ядро не извлекает корней и не делит.
+    \param[in] line Прямая
+    \param[in] circles Набор кругов
+    \param[out] mask Битовая маска, как в IntersectMask для отрезков
+    */
+    template <typename T>
+    void IntersectMask(const BasicLine<T> &line, const BasicCircleCloud<T> &circles,
+                       uint64_t *mask) {
+        for (std::size_t begin = 0; begin < circles.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, circles.Size() - begin);
+            mask[begin / 64] = detail::LineDiskChunk(line, circles, begin, count);
+        }
+    }
+
+    /*!
+    \ingroup circle
+    То же, что и IntersectMask(line, circles, mask), но пишет ответ в массив bool.
+    \param[out] out out[i] = Intersect(circles[i], line)
+    */
+    template <typename T>
+    void Intersect(const BasicLine<T> &line, const BasicCircleCloud<T> &circles, bool *out) {
+        for (std::size_t begin = 0; begin < circles.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, circles.Size() - begin);
+            uint64_t bits = detail::LineDiskChunk(line, circles, begin, count);
+            for (std::size_t k = 0; k < count; ++k) {
+                out[begin + k] = (bits >> k) & 1u;
+            }
+        }
+    }
+
+    /*!
+    \ingroup circle
+    Расстояния от прямой до каждого круга набора.
+    \param[in] line Прямая
+    \param[in] circles Набор кругов
+    \param[out] out out[i] = Dist(circles[i], line)
+    */
+    template <typename T>
+    void Dist(const BasicLine<T> &line, const BasicCircleCloud<T> &circles, RealType<T> *out) {
+        std::size_t n = circles.Size();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            double inv = 1 / line.GetNormal().Length();
+            const double *x = circles.X(), *y = circles.Y(), *r = circles.R();
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::LineDiskDistAvx512(line.A_, line.B_, line.C_, inv, x, y, r, n,
+                                                      out);
+                case SimdLevel::kAvx2:
+                    return detail::LineDiskDistAvx2(line.A_, line.B_, line.C_, inv, x, y, r, n,
+                                                    out);
+                case SimdLevel::kSse2:
+                    return detail::LineDiskDistSse2(line.A_, line.B_, line.C_, inv, x, y, r, n,
+                                                    out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = Dist(circles[i], line);
+        }
+    }
+}
+
+#endif //OLYMP_GEOMETRY_CIRCLE_CLOUD_H
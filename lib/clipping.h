@@ -0,0 +1,259 @@
+#ifndef OLYMP_GEOMETRY_CLIPPING_H
+#define OLYMP_GEOMETRY_CLIPPING_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "geometry-store.h"
+#include "olymp-geometry.h"
+#include "polygon.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Буферы отсечения, которые вызывающий переиспользует между вызовами: после
+    прогрева их ёмкости хватает, и отсечение не выделяет памяти.
+    \tparam T Тип координат входных многоугольников
+    */
+    template <typename T>
+    struct ClipBuffers {
+        //! Результат последнего отсечения одного многоугольника
+        std::vector<BasicVector<RealType<T>>> result_;
+        //! Промежуточные вершины при отсечении окном
+        std::vector<BasicVector<RealType<T>>> scratch_;
+    };
+
+    namespace detail {
+        // Один шаг Сазерленда - Ходжмана: оставляет вершины, для которых side >= 0, и
+        // вставляет точку пересечения на каждом ребре, концы которого строго по разные
+        // стороны границы. value - знаковое расстояние до границы с точностью до
+        // положительного множителя, по нему ищется точка пересечения.
+        template <typename P, typename Real, typename Side, typename Value>
+        void ClipStep(const P *polygon, std::size_t n, const Side &side, const Value &value,
+                      std::vector<BasicVector<Real>> &out) {
+            using Point = BasicVector<Real>;
+            out.clear();
+            if (n == 0) {
+                return;
+            }
+            Point previous(polygon[n - 1]);
+            int previous_side = side(previous);
+            Real previous_value = value(previous);
+            for (std::size_t i = 0; i < n; ++i) {
+                Point current(polygon[i]);
+                int current_side = side(current);
+                Real current_value = value(current);
+                if (current_side * previous_side < 0) {
+                    // Знаки точные, а значения нет, поэтому параметр зажимается в [0, 1].
+                    Real denominator = previous_value - current_value;
+                    Real t = denominator == 0 ? Real(0.5) : previous_value / denominator;
+                    t = std::clamp<Real>(t, 0, 1);
+                    out.emplace_back(previous.x_ + (current.x_ - previous.x_) * t,
+                                     previous.y_ + (current.y_ - previous.y_) * t);
+                }
+                if (current_side >= 0) {
+                    out.push_back(current);
+                }
+                previous = current;
+                previous_side = current_side;
+                previous_value = current_value;
+            }
+        }
+
+        template <typename P, typename T>
+        void ClipByLine(const P *polygon, std::size_t n, const BasicLine<T> &line,
+                        const BasicVector<T> &inside, ClipBuffers<T> &buffers) {
+            using Real = RealType<T>;
+            BasicLine<Real> real(line);
+            int sign = SideOfLine(line, inside);
+            if (sign == 0) {
+                buffers.result_.clear();
+                for (std::size_t i = 0; i < n; ++i) {
+                    buffers.result_.emplace_back(polygon[i]);
+                }
+                return;
+            }
+            auto side = [&](const BasicVector<Real> &p) { return SideOfLine(real, p) * sign; };
+            auto value = [&](const BasicVector<Real> &p) {
+                return (real.A_ * p.x_ + real.B_ * p.y_ + real.C_) * sign;
+            };
+            ClipStep(polygon, n, side, value, buffers.result_);
+        }
+
+        // Отсекает по очереди каждым ребром окна против часовой стрелки. Буферы
+        // меняются местами, так что результат всегда в buffers.result_.
+        template <typename P, typename T>
+        void ClipByWindow(const P *polygon, std::size_t n, const BasicPolygon<T> &window,
+                          ClipBuffers<T> &buffers) {
+            using Point = BasicVector<RealType<T>>;
+            std::size_t m = window.Size();
+            auto edge_step = [&](std::size_t k, const auto *input, std::size_t size,
+                                 std::vector<Point> &out) {
+                Point a(CounterClockwiseVertex(window, k));
+                Point b(CounterClockwiseVertex(window, k + 1 == m ? 0 : k + 1));
+                Point direction = b - a;
+                auto side = [&](const Point &p) { return Orient2D(a, b, p); };
+                auto value = [&](const Point &p) { return VectorMultiplication(direction, p - a); };
+                ClipStep(input, size, side, value, out);
+            };
+            edge_step(0, polygon, n, buffers.result_);
+            for (std::size_t k = 1; k < m && !buffers.result_.empty(); ++k) {
+                edge_step(k, buffers.result_.data(), buffers.result_.size(), buffers.scratch_);
+                buffers.result_.swap(buffers.scratch_);
+            }
+        }
+
+        // Отсекает каждый многоугольник плоского массива через clip и после каждого
+        // вызывает emit, который забирает результат из буферов.
+        template <typename Vertices, typename Offsets, typename Clip, typename Emit>
+        void ForEachClipped(const Vertices &vertices, const Offsets &offsets, const Clip &clip,
+                            const Emit &emit) {
+            for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+                clip(vertices.data() + offsets[i], offsets[i + 1] - offsets[i]);
+                emit();
+            }
+        }
+
+        // Пакетное отсечение в плоский массив со смещениями.
+        template <typename T, typename Clip>
+        void ClipEach(const std::vector<BasicVector<T>> &vertices,
+                      const std::vector<std::size_t> &offsets,
+                      std::vector<BasicVector<RealType<T>>> &out_vertices,
+                      std::vector<std::size_t> &out_offsets, ClipBuffers<T> &buffers,
+                      const Clip &clip) {
+            out_vertices.clear();
+            out_offsets.clear();
+            out_offsets.push_back(0);
+            ForEachClipped(vertices, offsets, clip, [&] {
+                out_vertices.insert(out_vertices.end(), buffers.result_.begin(),
+                                    buffers.result_.end());
+                out_offsets.push_back(out_vertices.size());
+            });
+        }
+
+        // Пакетное отсечение из хранилища в хранилище.
+        template <typename T, typename Clip>
+        void ClipEach(const BasicGeometryStore<T> &shapes, BasicGeometryStore<RealType<T>> &out,
+                      ClipBuffers<T> &buffers, const Clip &clip) {
+            out.Clear();
+            ForEachClipped(shapes.Vertices(), shapes.Offsets(), clip,
+                           [&] { out.Add(buffers.result_); });
+        }
+    }
+
+    /*!
+    \defgroup clipping Отсечение многоугольников
+    \ingroup polygon
+    \brief Алгоритм Сазерленда - Ходжмана: отсечение полуплоскостью и выпуклым окном.
+    Сторона каждой вершины определяется точными предикатами, а точки пересечения
+    вычисляются в RealType<T>. Вершины на границе остаются, новые вершины появляются только
+    на рёбрах, пересекающих границу, поэтому результат не содержит лишних повторов, но
+    может быть вырожденным - например, отрезком вдоль границы. Весь вывод пишется в
+    переданные вызывающим буферы: после того как их ёмкость выросла до нужной, отсечение
+    не выделяет памяти.
+    */
+    ///@{
+
+    /*!
+    Отсекает многоугольник полуплоскостью.
+    \param[in] polygon Вершины многоугольника
+    \param[in] line Граница полуплоскости
+    \param[in] inside Точка, задающая сторону: остаются вершины v, для которых
+    OnSameSideEq(line, v, inside). Если inside лежит на прямой, многоугольник не меняется
+    \param[in,out] buffers Буферы
+    \return buffers.result_ с вершинами результата
+    */
+    template <typename T>
+    const std::vector<BasicVector<RealType<T>>> &ClipByLine(
+            const std::vector<BasicVector<T>> &polygon, const BasicLine<T> &line,
+            const BasicVector<T> &inside, ClipBuffers<T> &buffers) {
+        detail::ClipByLine(polygon.data(), polygon.size(), line, inside, buffers);
+        return buffers.result_;
+    }
+
+    /*!
+    Отсекает многоугольник выпуклым окном за O(n * m).
+    \param[in] polygon Вершины многоугольника, возможно невыпуклого. Для невыпуклого
+    результат может содержать рёбра нулевой площади вдоль границы окна
+    \param[in] window Окно, window.IsConvex(), вершины в любом порядке обхода
+    \param[in,out] buffers Буферы
+    \return buffers.result_ с вершинами результата, против часовой стрелки, если так шли
+    вершины polygon
+    */
+    template <typename T>
+    const std::vector<BasicVector<RealType<T>>> &ClipByWindow(
+            const std::vector<BasicVector<T>> &polygon, const BasicPolygon<T> &window,
+            ClipBuffers<T> &buffers) {
+        detail::ClipByWindow(polygon.data(), polygon.size(), window, buffers);
+        return buffers.result_;
+    }
+
+    /*!
+    Пакетная версия ClipByLine для многих многоугольников в одном плоском массиве.
+    \param[in] vertices Вершины всех многоугольников подряд
+    \param[in] offsets Многоугольник i - вершины [offsets[i], offsets[i + 1])
+    \param[in] line Граница полуплоскости
+    \param[in] inside Точка, задающая сторону
+    \param[out] out_vertices Вершины результатов подряд
+    \param[out] out_offsets Смещения результатов в том же формате, что и offsets. Пустые
+    результаты остаются пустыми отрезками, так что номера многоугольников сохраняются
+    \param[in,out] buffers Буферы
+    */
+    template <typename T>
+    void ClipByLine(const std::vector<BasicVector<T>> &vertices,
+                    const std::vector<std::size_t> &offsets, const BasicLine<T> &line,
+                    const BasicVector<T> &inside,
+                    std::vector<BasicVector<RealType<T>>> &out_vertices,
+                    std::vector<std::size_t> &out_offsets, ClipBuffers<T> &buffers) {
+        detail::ClipEach(vertices, offsets, out_vertices, out_offsets, buffers,
+                         [&](const BasicVector<T> *polygon, std::size_t n) {
+                             detail::ClipByLine(polygon, n, line, inside, buffers);
+                         });
+    }
+
+    /*!
+    Пакетная версия ClipByWindow, формат как у пакетной ClipByLine.
+    */
+    template <typename T>
+    void ClipByWindow(const std::vector<BasicVector<T>> &vertices,
+                      const std::vector<std::size_t> &offsets, const BasicPolygon<T> &window,
+                      std::vector<BasicVector<RealType<T>>> &out_vertices,
+                      std::vector<std::size_t> &out_offsets, ClipBuffers<T> &buffers) {
+        detail::ClipEach(vertices, offsets, out_vertices, out_offsets, buffers,
+                         [&](const BasicVector<T> *polygon, std::size_t n) {
+                             detail::ClipByWindow(polygon, n, window, buffers);
+                         });
+    }
+
+    /*!
+    Пакетная версия ClipByLine для фигур из хранилища.
+    \param[in] shapes Многоугольники
+    \param[in] line Граница полуплоскости
+    \param[in] inside Точка, задающая сторону
+    \param[out] out Результаты в том же порядке, пустые остаются пустыми фигурами. Старое
+    содержимое удаляется
+    \param[in,out] buffers Буферы
+    */
+    template <typename T>
+    void ClipByLine(const BasicGeometryStore<T> &shapes, const BasicLine<T> &line,
+                    const BasicVector<T> &inside, BasicGeometryStore<RealType<T>> &out,
+                    ClipBuffers<T> &buffers) {
+        detail::ClipEach(shapes, out, buffers, [&](const BasicVector<T> *polygon, std::size_t n) {
+            detail::ClipByLine(polygon, n, line, inside, buffers);
+        });
+    }
+
+    /*!
+    Пакетная версия ClipByWindow для фигур из хранилища, формат как у ClipByLine.
+    */
+    template <typename T>
+    void ClipByWindow(const BasicGeometryStore<T> &shapes, const BasicPolygon<T> &window,
+                      BasicGeometryStore<RealType<T>> &out, ClipBuffers<T> &buffers) {
+        detail::ClipEach(shapes, out, buffers, [&](const BasicVector<T> *polygon, std::size_t n) {
+            detail::ClipByWindow(polygon, n, window, buffers);
+        });
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_CLIPPING_H
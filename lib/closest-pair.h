@@ -0,0 +1,273 @@
+#ifndef OLYMP_GEOMETRY_CLOSEST_PAIR_H
+#define OLYMP_GEOMETRY_CLOSEST_PAIR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "parallel.h"
+
+namespace olymp_geometry {
+    namespace detail {
+        // С какого размера половины рекурсии решаются в разных потоках.
+        constexpr std::size_t kParallelClosestPairSize = 1 << 14;
+
+        template <typename T>
+        struct PairPoint {
+            BasicVector<T> point_;
+            std::size_t id_;
+        };
+
+        template <typename T>
+        struct PairCandidate {
+            RealType<T> distance_ = std::numeric_limits<RealType<T>>::infinity();
+            std::size_t first_ = 0, second_ = 0;
+
+            void Consider(const PairPoint<T> &a, const PairPoint<T> &b) {
+                RealType<T> d = DistSquared(a.point_, b.point_);
+                if (d < distance_) {
+                    distance_ = d;
+                    first_ = std::min(a.id_, b.id_);
+                    second_ = std::max(a.id_, b.id_);
+                }
+            }
+        };
+
+        template <typename T>
+        bool LessY(const PairPoint<T> &a, const PairPoint<T> &b) {
+            return a.point_.y_ < b.point_.y_;
+        }
+
+        // Ближайшая пара среди points[low, high), упорядоченных по x. На выходе отрезок
+        // упорядочен по y. buffer[low, high) - рабочая память.
+        template <typename T>
+        PairCandidate<T> ClosestPairRecursive(PairPoint<T> *points, PairPoint<T> *buffer,
+                                              std::size_t low, std::size_t high, int spawn) {
+            PairCandidate<T> best;
+            if (high - low <= 3) {
+                for (std::size_t i = low; i < high; ++i) {
+                    for (std::size_t j = i + 1; j < high; ++j) {
+                        best.Consider(points[i], points[j]);
+                    }
+                }
+                std::sort(points + low, points + high, LessY<T>);
+                return best;
+            }
+            std::size_t middle = (low + high) / 2;
+            T middle_x = points[middle].point_.x_;
+            PairCandidate<T> right;
+            ParallelInvoke(
+                    spawn > 0 && high - low >= kParallelClosestPairSize,
+                    [&] { best = ClosestPairRecursive(points, buffer, low, middle, spawn - 1); },
+                    [&] { right = ClosestPairRecursive(points, buffer, middle, high, spawn - 1); });
+            if (right.distance_ < best.distance_) {
+                best = right;
+            }
+            std::merge(points + low, points + middle, points + middle, points + high,
+                       buffer + low, LessY<T>);
+            std::copy(buffer + low, buffer + high, points + low);
+            // Полоса у средней прямой в порядке y: каждой точке достаточно проверить
+            // предыдущие точки полосы, пока разница по y меньше текущего ответа.
+            std::size_t strip = low;
+            for (std::size_t i = low; i < high; ++i) {
+                RealType<T> dx = static_cast<RealType<T>>(points[i].point_.x_) - middle_x;
+                if (dx * dx >= best.distance_) {
+                    continue;
+                }
+                for (std::size_t j = strip; j-- > low;) {
+                    RealType<T> dy =
+                            static_cast<RealType<T>>(points[i].point_.y_) - buffer[j].point_.y_;
+                    if (dy * dy >= best.distance_) {
+                        break;
+                    }
+                    best.Consider(points[i], buffer[j]);
+                }
+                buffer[strip++] = points[i];
+            }
+            return best;
+        }
+
+        // Точки, разложенные по квадратным ячейкам со стороной не меньше distance: пары
+        // ближе distance лежат в одной или в соседних ячейках.
+        template <typename T>
+        class CloseGrid {
+        public:
+            CloseGrid(const std::vector<BasicVector<T>> &points, RealType<T> distance) {
+                std::size_t n = points.size();
+                RealType<T> min_x = points[0].x_, min_y = points[0].y_;
+                RealType<T> max_x = min_x, max_y = min_y;
+                for (const BasicVector<T> &p : points) {
+                    min_x = std::min<RealType<T>>(min_x, p.x_);
+                    min_y = std::min<RealType<T>>(min_y, p.y_);
+                    max_x = std::max<RealType<T>>(max_x, p.x_);
+                    max_y = std::max<RealType<T>>(max_y, p.y_);
+                }
+                // Номера ячеек должны помещаться в int64_t даже при очень малом distance.
+                RealType<T> cell = std::max({distance, (max_x - min_x) / (1 << 30),
+                                             (max_y - min_y) / (1 << 30)});
+                if (!(cell > 0)) {
+                    cell = 1;
+                }
+                entries_.resize(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    entries_[i] = {static_cast<int64_t>((points[i].x_ - min_x) / cell),
+                                   static_cast<int64_t>((points[i].y_ - min_y) / cell), i};
+                }
+                std::sort(entries_.begin(), entries_.end());
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (i == 0 || Key(entries_[i]) != Key(entries_[i - 1])) {
+                        cells_.push_back({Key(entries_[i]), i});
+                    }
+                }
+                cells_.push_back({{std::numeric_limits<int64_t>::max(), 0}, n});
+            }
+
+            std::size_t CellCount() const {
+                return cells_.size() - 1;
+            }
+
+            // Вызывает report(i, j) для пар из ячейки c и из её соседей справа и сверху,
+            // так что каждая пара соседних ячеек просматривается один раз.
+            template <typename Report>
+            void ForEachPairFrom(std::size_t c, const Report &report) const {
+                auto [x, y] = cells_[c].first;
+                const std::pair<int64_t, int64_t> neighbours[] = {
+                        {x, y + 1}, {x + 1, y - 1}, {x + 1, y}, {x + 1, y + 1}};
+                for (std::size_t i = cells_[c].second; i < cells_[c + 1].second; ++i) {
+                    for (std::size_t j = i + 1; j < cells_[c + 1].second; ++j) {
+                        report(std::get<2>(entries_[i]), std::get<2>(entries_[j]));
+                    }
+                }
+                for (const std::pair<int64_t, int64_t> &key : neighbours) {
+                    auto cell = std::lower_bound(
+                            cells_.begin(), cells_.end() - 1, key,
+                            [](const auto &a, const auto &b) { return a.first < b; });
+                    if (cell == cells_.end() - 1 || cell->first != key) {
+                        continue;
+                    }
+                    for (std::size_t i = cells_[c].second; i < cells_[c + 1].second; ++i) {
+                        for (std::size_t j = cell->second; j < (cell + 1)->second; ++j) {
+                            report(std::get<2>(entries_[i]), std::get<2>(entries_[j]));
+                        }
+                    }
+                }
+            }
+
+        private:
+            using Entry = std::tuple<int64_t, int64_t, std::size_t>;
+
+            static std::pair<int64_t, int64_t> Key(const Entry &entry) {
+                return {std::get<0>(entry), std::get<1>(entry)};
+            }
+
+            std::vector<Entry> entries_;
+            // Ключ ячейки и начало её точек в entries_, в конце - ограничитель.
+            std::vector<std::pair<std::pair<int64_t, int64_t>, std::size_t>> cells_;
+        };
+    }
+
+    /*!
+    \defgroup closest_pair Ближайшие пары точек
+    \brief Ближайшая пара точек и все пары точек ближе заданного расстояния.
+    */
+    ///@{
+
+    /*!
+    Ближайшая пара точек "разделяй и властвуй" за O(n log n) на квадратах расстояний.
+    Половины рекурсии размером от нескольких тысяч точек решаются в разных потоках,
+    всего не больше GetThreadCount().
+    \param[in] points Точки
+    \return Индексы first < second пары с наименьшим Dist, nullopt для меньше чем двух точек
+    */
+    template <typename T>
+    std::optional<std::pair<std::size_t, std::size_t>> ClosestPair(
+            const std::vector<BasicVector<T>> &points) {
+        std::size_t n = points.size();
+        if (n < 2) {
+            return std::nullopt;
+        }
+        std::vector<detail::PairPoint<T>> sorted(n), buffer(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            sorted[i] = {points[i], i};
+        }
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const detail::PairPoint<T> &a, const detail::PairPoint<T> &b) {
+                      return a.point_.x_ < b.point_.x_;
+                  });
+        detail::PairCandidate<T> best = detail::ClosestPairRecursive(
+                sorted.data(), buffer.data(), 0, n, detail::ParallelDepth());
+        return std::make_pair(best.first_, best.second_);
+    }
+
+    /*!
+    Потоковая версия FindClosePairs: вызывает report(i, j) для каждой пары точек с
+    Dist(points[i], points[j]) <= distance, не собирая их в память. Точки раскладываются
+    по ячейкам сетки со стороной distance, и сравниваются только точки соседних ячеек.
+    \param[in] points Точки
+    \param[in] distance Расстояние
+    \param[in] report Функция от пары индексов i < j, порядок пар не определён
+    */
+    template <typename T, typename Report>
+    void ForEachClosePair(const std::vector<BasicVector<T>> &points, RealType<T> distance,
+                          const Report &report) {
+        if (points.size() < 2 || distance < 0) {
+            return;
+        }
+        detail::CloseGrid<T> grid(points, distance);
+        RealType<T> limit = distance * distance;
+        for (std::size_t c = 0; c < grid.CellCount(); ++c) {
+            grid.ForEachPairFrom(c, [&](std::size_t i, std::size_t j) {
+                if (DistSquared(points[i], points[j]) <= limit) {
+                    report(std::min(i, j), std::max(i, j));
+                }
+            });
+        }
+    }
+
+    /*!
+    Все пары точек ближе заданного расстояния. Ячейки сетки делятся между
+    GetThreadCount() потоками.
+    \param[in] points Точки
+    \param[in] distance Расстояние
+    \return Пары индексов (i, j), i < j, с Dist(points[i], points[j]) <= distance, по
+    возрастанию
+    */
+    template <typename T>
+    std::vector<std::pair<std::size_t, std::size_t>> FindClosePairs(
+            const std::vector<BasicVector<T>> &points, RealType<T> distance) {
+        std::vector<std::pair<std::size_t, std::size_t>> result;
+        if (points.size() < 2 || distance < 0) {
+            return result;
+        }
+        detail::CloseGrid<T> grid(points, distance);
+        RealType<T> limit = distance * distance;
+        std::size_t chunks = std::max<std::size_t>(
+                1, std::min<std::size_t>(GetThreadCount(), points.size() / 1024));
+        std::vector<std::vector<std::pair<std::size_t, std::size_t>>> local(chunks);
+        auto search = [&](std::size_t k, std::size_t from, std::size_t to) {
+            for (std::size_t c = from; c < to; ++c) {
+                grid.ForEachPairFrom(c, [&](std::size_t i, std::size_t j) {
+                    if (DistSquared(points[i], points[j]) <= limit) {
+                        local[k].emplace_back(std::min(i, j), std::max(i, j));
+                    }
+                });
+            }
+        };
+        detail::ForEachChunk(grid.CellCount(), chunks, search);
+        for (const std::vector<std::pair<std::size_t, std::size_t>> &pairs : local) {
+            result.insert(result.end(), pairs.begin(), pairs.end());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_CLOSEST_PAIR_H
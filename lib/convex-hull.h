@@ -0,0 +1,213 @@
+#ifndef OLYMP_GEOMETRY_CONVEX_HULL_H
+#define OLYMP_GEOMETRY_CONVEX_HULL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "parallel.h"
+
+namespace olymp_geometry {
+    namespace detail {
+        // Меньше стольких точек на поток оболочка строится в одном потоке.
+        constexpr std::size_t kHullGrain = 1 << 15;
+
+        template <typename T>
+        bool LessXY(const BasicVector<T> &a, const BasicVector<T> &b) {
+            return a.x_ < b.x_ || (a.x_ == b.x_ && a.y_ < b.y_);
+        }
+
+        // Восемь крайних точек: по осям и диагоналям, в порядке обхода против часовой
+        // стрелки начиная с нижней.
+        template <typename T>
+        std::array<BasicVector<T>, 8> ExtremePoints(const BasicVector<T> *points,
+                                                    std::size_t n) {
+            std::array<BasicVector<T>, 8> extreme;
+            extreme.fill(points[0]);
+            for (std::size_t i = 1; i < n; ++i) {
+                const BasicVector<T> &p = points[i];
+                std::array<BasicVector<T>, 8> &e = extreme;
+                if (p.y_ < e[0].y_) {
+                    e[0] = p;
+                }
+                if (p.x_ - p.y_ > e[1].x_ - e[1].y_) {
+                    e[1] = p;
+                }
+                if (p.x_ > e[2].x_) {
+                    e[2] = p;
+                }
+                if (p.x_ + p.y_ > e[3].x_ + e[3].y_) {
+                    e[3] = p;
+                }
+                if (p.y_ > e[4].y_) {
+                    e[4] = p;
+                }
+                if (p.y_ - p.x_ > e[5].y_ - e[5].x_) {
+                    e[5] = p;
+                }
+                if (p.x_ < e[6].x_) {
+                    e[6] = p;
+                }
+                if (p.x_ + p.y_ < e[7].x_ + e[7].y_) {
+                    e[7] = p;
+                }
+            }
+            return extreme;
+        }
+
+        // Отсев Акла-Туссена: точки строго внутри восьмиугольника из крайних точек не могут
+        // быть на границе оболочки, для равномерно распределённых точек остаётся O(sqrt(n)).
+        // Проверка через точный Orient2D, чтобы не потерять точки на рёбрах оболочки.
+        template <typename T>
+        std::vector<BasicVector<T>> AklToussaint(const std::vector<BasicVector<T>> &points,
+                                                 std::size_t chunks) {
+            std::size_t n = points.size();
+            std::vector<std::array<BasicVector<T>, 8>> local(chunks);
+            ForEachChunk(n, chunks, [&](std::size_t k, std::size_t from, std::size_t to) {
+                local[k] = ExtremePoints(points.data() + from, to - from);
+            });
+            // Крайние точки всего множества - крайние среди крайних точек частей.
+            std::vector<BasicVector<T>> candidates;
+            for (const std::array<BasicVector<T>, 8> &e : local) {
+                candidates.insert(candidates.end(), e.begin(), e.end());
+            }
+            std::array<BasicVector<T>, 8> extreme =
+                    ExtremePoints(candidates.data(), candidates.size());
+            std::vector<BasicVector<T>> octagon;
+            for (const BasicVector<T> &e : extreme) {
+                if (octagon.empty() || !(octagon.back() == e)) {
+                    octagon.push_back(e);
+                }
+            }
+            while (octagon.size() > 1 && octagon.back() == octagon.front()) {
+                octagon.pop_back();
+            }
+            if (octagon.size() < 3) {
+                return points;
+            }
+            auto inside = [&octagon](const BasicVector<T> &p) {
+                for (std::size_t i = 0; i < octagon.size(); ++i) {
+                    const BasicVector<T> &b = octagon[i + 1 == octagon.size() ? 0 : i + 1];
+                    if (Orient2D(octagon[i], b, p) <= 0) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+            std::vector<std::vector<BasicVector<T>>> survivors(chunks);
+            ForEachChunk(n, chunks, [&](std::size_t k, std::size_t from, std::size_t to) {
+                for (std::size_t i = from; i < to; ++i) {
+                    if (!inside(points[i])) {
+                        survivors[k].push_back(points[i]);
+                    }
+                }
+            });
+            std::vector<BasicVector<T>> result;
+            for (const std::vector<BasicVector<T>> &s : survivors) {
+                result.insert(result.end(), s.begin(), s.end());
+            }
+            return result;
+        }
+
+        // Монотонная цепочка Эндрю по точкам, упорядоченным LessXY, без повторов.
+        template <typename T>
+        std::vector<BasicVector<T>> MonotoneChain(const std::vector<BasicVector<T>> &points,
+                                                  bool keep_collinear) {
+            std::size_t n = points.size();
+            if (n <= 2) {
+                return points;
+            }
+            const BasicVector<T> &first = points[0], &last = points[n - 1];
+            bool collinear = true;
+            for (std::size_t i = 1; collinear && i + 1 < n; ++i) {
+                collinear = VectorMultiplication(last - first, points[i] - first) == 0;
+            }
+            if (collinear) {
+                return keep_collinear ? points : std::vector<BasicVector<T>>{first, last};
+            }
+            // Поворот a -> b -> c, при котором b выбрасывается из оболочки.
+            auto redundant = [keep_collinear](const BasicVector<T> &a, const BasicVector<T> &b,
+                                              const BasicVector<T> &c) {
+                T cross = VectorMultiplication(b - a, c - a);
+                return keep_collinear ? cross < 0 : cross <= 0;
+            };
+            std::vector<BasicVector<T>> hull;
+            hull.reserve(n + 1);
+            for (std::size_t i = 0; i < n; ++i) {
+                while (hull.size() >= 2 &&
+                       redundant(hull[hull.size() - 2], hull.back(), points[i])) {
+                    hull.pop_back();
+                }
+                hull.push_back(points[i]);
+            }
+            std::size_t lower = hull.size();
+            for (std::size_t i = n - 1; i-- > 0;) {
+                while (hull.size() > lower &&
+                       redundant(hull[hull.size() - 2], hull.back(), points[i])) {
+                    hull.pop_back();
+                }
+                hull.push_back(points[i]);
+            }
+            hull.pop_back();
+            return hull;
+        }
+
+        template <typename T>
+        std::vector<BasicVector<T>> SortedHull(std::vector<BasicVector<T>> &points,
+                                               bool keep_collinear) {
+            std::sort(points.begin(), points.end(), LessXY<T>);
+            points.erase(std::unique(points.begin(), points.end()), points.end());
+            return MonotoneChain(points, keep_collinear);
+        }
+    }
+
+    /*!
+    \defgroup convex_hull Выпуклая оболочка
+    \brief Выпуклая оболочка множества точек.
+    */
+    ///@{
+
+    /*!
+    Выпуклая оболочка монотонной цепочкой Эндрю с поворотами через VectorMultiplication.
+    Сначала отсев Акла-Туссена убирает точки внутри восьмиугольника из крайних точек. На
+    больших входах отсев и построение идут в GetThreadCount() потоках: каждый поток
+    сортирует свою часть и строит её оболочку, а затем оболочка строится по вершинам
+    оболочек частей.
+    \param[in] points Точки, возможно с повторами
+    \param[in] keep_collinear Оставлять ли точки, лежащие на рёбрах оболочки
+    \return Вершины против часовой стрелки, начиная с наименьшей по (x, y). Если все точки
+    на одной прямой, то её концы, или все различные точки по порядку при keep_collinear
+    */
+    template <typename T>
+    std::vector<BasicVector<T>> ConvexHull(const std::vector<BasicVector<T>> &points,
+                                           bool keep_collinear = false) {
+        if (points.empty()) {
+            return {};
+        }
+        std::size_t chunks = std::max<std::size_t>(
+                1, std::min<std::size_t>(GetThreadCount(), points.size() / detail::kHullGrain));
+        std::vector<BasicVector<T>> candidates = detail::AklToussaint(points, chunks);
+        chunks = std::max<std::size_t>(
+                1, std::min<std::size_t>(chunks, candidates.size() / detail::kHullGrain));
+        if (chunks == 1) {
+            return detail::SortedHull(candidates, keep_collinear);
+        }
+        std::vector<std::vector<BasicVector<T>>> hulls(chunks);
+        auto build = [&](std::size_t k, std::size_t from, std::size_t to) {
+            std::vector<BasicVector<T>> part(candidates.begin() + from, candidates.begin() + to);
+            hulls[k] = detail::SortedHull(part, keep_collinear);
+        };
+        detail::ForEachChunk(candidates.size(), chunks, build);
+        // Вершина итоговой оболочки лежит на границе оболочки своей части.
+        std::vector<BasicVector<T>> merged;
+        for (const std::vector<BasicVector<T>> &hull : hulls) {
+            merged.insert(merged.end(), hull.begin(), hull.end());
+        }
+        return detail::SortedHull(merged, keep_collinear);
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_CONVEX_HULL_H
@@ -0,0 +1,149 @@
+#ifndef OLYMP_GEOMETRY_ENCLOSING_CIRCLE_H
+#define OLYMP_GEOMETRY_ENCLOSING_CIRCLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "parallel.h"
+
+namespace olymp_geometry {
+    namespace detail {
+        // Столько точек в сумме должно приходиться на поток в пакетной версии.
+        constexpr std::size_t kEnclosingCircleGrain = 1 << 14;
+
+        // Круг, заданный квадратом радиуса: проверка точек обходится без корня.
+        template <typename T>
+        struct SquaredCircle {
+            BasicVector<T> center_;
+            T radius_squared_ = 0;
+
+            // Относительный допуск не даёт точкам на границе, посчитанной с округлением,
+            // снова и снова перестраивать круг.
+            bool Covers(const BasicVector<T> &p) const {
+                return DistSquared(center_, p) <= radius_squared_ * (1 + 1e-12L);
+            }
+        };
+
+        template <typename T>
+        SquaredCircle<T> DiameterCircle(const BasicVector<T> &a, const BasicVector<T> &b) {
+            BasicVector<T> center((a.x_ + b.x_) / 2, (a.y_ + b.y_) / 2);
+            return {center, DistSquared(center, a)};
+        }
+
+        // Описанная окружность треугольника, посчитанная относительно вершины a. Для почти
+        // вырожденного треугольника - круг на самой длинной стороне как на диаметре.
+        template <typename T>
+        SquaredCircle<T> Circumcircle(const BasicVector<T> &a, const BasicVector<T> &b,
+                                      const BasicVector<T> &c) {
+            BasicVector<T> ab = b - a, ac = c - a;
+            T cross = VectorMultiplication(ab, ac);
+            T ab_squared = ScalarMultiplication(ab, ab), ac_squared = ScalarMultiplication(ac, ac);
+            if (Abs(cross) <= kEpsOf<T> * (ab_squared + ac_squared)) {
+                if (DistSquared(b, c) >= std::max(ab_squared, ac_squared)) {
+                    return DiameterCircle(b, c);
+                }
+                return ab_squared >= ac_squared ? DiameterCircle(a, b) : DiameterCircle(a, c);
+            }
+            BasicVector<T> offset((ac.y_ * ab_squared - ab.y_ * ac_squared) / (2 * cross),
+                                  (ab.x_ * ac_squared - ac.x_ * ab_squared) / (2 * cross));
+            return {a + offset, ScalarMultiplication(offset, offset)};
+        }
+
+        // Алгоритм Велцля в итеративной форме: три вложенных цикла вместо рекурсии по
+        // граничным точкам. Точки должны быть уже перемешаны.
+        template <typename T>
+        BasicCircle<T> WelzlCircle(const BasicVector<T> *points, std::size_t n) {
+            if (n == 0) {
+                return BasicCircle<T>();
+            }
+            SquaredCircle<T> circle{points[0], 0};
+            for (std::size_t i = 1; i < n; ++i) {
+                if (circle.Covers(points[i])) {
+                    continue;
+                }
+                // points[i] лежит на границе круга для первых i + 1 точек.
+                circle = {points[i], 0};
+                for (std::size_t j = 0; j < i; ++j) {
+                    if (circle.Covers(points[j])) {
+                        continue;
+                    }
+                    circle = DiameterCircle(points[i], points[j]);
+                    for (std::size_t k = 0; k < j; ++k) {
+                        if (!circle.Covers(points[k])) {
+                            circle = Circumcircle(points[i], points[j], points[k]);
+                        }
+                    }
+                }
+            }
+            return BasicCircle<T>(circle.center_, std::sqrt(circle.radius_squared_));
+        }
+
+        template <typename T>
+        BasicCircle<RealType<T>> MinEnclosingCircle(std::vector<BasicVector<T>> &points,
+                                                    uint64_t seed) {
+            std::shuffle(points.begin(), points.end(), std::mt19937_64(seed));
+            if constexpr (std::is_floating_point_v<T>) {
+                return WelzlCircle(points.data(), points.size());
+            } else {
+                std::vector<BasicVector<RealType<T>>> real(points.begin(), points.end());
+                return WelzlCircle(real.data(), real.size());
+            }
+        }
+    }
+
+    /*!
+    \defgroup enclosing_circle Наименьший охватывающий круг
+    \brief Наименьший круг, содержащий все точки множества.
+    */
+    ///@{
+
+    /*!
+    Наименьший охватывающий круг рандомизированным инкрементальным алгоритмом Велцля за
+    ожидаемое O(n). Точки перемешиваются на месте, а рекурсия по граничным точкам
+    развёрнута в три вложенных цикла, так что глубина стека не зависит от n и 10^7 точек
+    обрабатываются без дополнительной памяти (для целых координат - с одной копией в
+    RealType<T>).
+    \param[in,out] points Точки. Порядок после вызова не определён
+    \param[in] seed Зерно перемешивания: от него зависит только время работы
+    \return Круг, для пустого набора - нулевой круг в начале координат
+    */
+    template <typename T>
+    BasicCircle<RealType<T>> MinEnclosingCircle(std::vector<BasicVector<T>> &points,
+                                                uint64_t seed = 0) {
+        return detail::MinEnclosingCircle(points, seed);
+    }
+
+    /*!
+    Пакетная версия MinEnclosingCircle для независимых групп точек. Группы делятся между
+    GetThreadCount() потоками так, чтобы на поток приходилось не меньше нескольких тысяч
+    точек, и результат не зависит от числа потоков.
+    \param[in,out] groups Группы точек, каждая перемешивается на месте
+    \param[in] seed Зерно перемешивания, группа i перемешивается с зерном seed + i
+    \return Круги в порядке групп
+    */
+    template <typename T>
+    std::vector<BasicCircle<RealType<T>>> MinEnclosingCircles(
+            std::vector<std::vector<BasicVector<T>>> &groups, uint64_t seed = 0) {
+        std::vector<BasicCircle<RealType<T>>> circles(groups.size());
+        std::size_t total = 0;
+        for (const std::vector<BasicVector<T>> &group : groups) {
+            total += group.size();
+        }
+        std::size_t grain =
+                groups.size() * detail::kEnclosingCircleGrain / std::max<std::size_t>(total, 1);
+        detail::ParallelFor(0, groups.size(), grain, [&](std::size_t from, std::size_t to) {
+            for (std::size_t i = from; i < to; ++i) {
+                circles[i] = detail::MinEnclosingCircle(groups[i], seed + i);
+            }
+        });
+        return circles;
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_ENCLOSING_CIRCLE_H
@@ -0,0 +1,349 @@
+#ifndef OLYMP_GEOMETRY_FAST_IO_H
+#define OLYMP_GEOMETRY_FAST_IO_H
+
+#include <charconv>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define OLYMP_GEOMETRY_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define OLYMP_GEOMETRY_MMAP 0
+#endif
+
+#include "geometry-store.h"
+#include "olymp-geometry.h"
+
+namespace olymp_geometry {
+    /*!
+    \defgroup fast_io Быстрый ввод-вывод
+    \brief Чтение и запись координат через std::from_chars и std::to_chars: без локалей и
+    виртуальных вызовов iostream. Формат тот же, что у операторов >> и <<: числа через
+    пробельные символы, точка - два числа, прямая - три, отрезок и луч - четыре.
+    */
+    ///@{
+
+    /*!
+    \brief Файл, целиком отображённый в память (mmap). На системах без mmap файл читается
+    в буфер. Содержимое доступно через View(), пока объект жив.
+    */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+
+        explicit MappedFile(const std::string &path) {
+#if OLYMP_GEOMETRY_MMAP
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            struct stat info;
+            if (::fstat(fd, &info) == 0) {
+                size_ = static_cast<std::size_t>(info.st_size);
+                if (size_ == 0) {
+                    open_ = true;
+                } else {
+                    void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (data != MAP_FAILED) {
+                        ::madvise(data, size_, MADV_SEQUENTIAL);
+                        data_ = static_cast<const char *>(data);
+                        open_ = true;
+                    }
+                }
+            }
+            ::close(fd);
+#else
+            std::ifstream in(path, std::ios::binary);
+            if (in) {
+                buffer_.assign(std::istreambuf_iterator<char>(in),
+                               std::istreambuf_iterator<char>());
+                data_ = buffer_.data();
+                size_ = buffer_.size();
+                open_ = true;
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        MappedFile(MappedFile &&other) noexcept {
+            Swap(other);
+        }
+
+        MappedFile &operator=(MappedFile &&other) noexcept {
+            MappedFile(std::move(other)).Swap(*this);
+            return *this;
+        }
+
+        ~MappedFile() {
+#if OLYMP_GEOMETRY_MMAP
+            if (data_ != nullptr) {
+                ::munmap(const_cast<char *>(data_), size_);
+            }
+#endif
+        }
+
+        //! true, если файл удалось открыть
+        bool IsOpen() const {
+            return open_;
+        }
+
+        std::string_view View() const {
+            return {data_, size_};
+        }
+
+    private:
+        void Swap(MappedFile &other) {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(open_, other.open_);
+#if !OLYMP_GEOMETRY_MMAP
+            std::swap(buffer_, other.buffer_);
+            data_ = buffer_.data();
+            other.data_ = other.buffer_.data();
+#endif
+        }
+
+        const char *data_ = nullptr;
+        std::size_t size_ = 0;
+        bool open_ = false;
+#if !OLYMP_GEOMETRY_MMAP
+        std::string buffer_;
+#endif
+    };
+
+    /*!
+    \brief Последовательное чтение чисел и объектов из буфера. Буфер не копируется и должен
+    жить дольше читателя.
+
+    Каждый Read возвращает false, если данные кончились или очередное число записано
+    неверно; после этого читатель остаётся в состоянии ошибки, как std::istream.
+    */
+    class FastReader {
+    public:
+        explicit FastReader(std::string_view buffer)
+            : current_(buffer.data()), end_(buffer.data() + buffer.size()) {
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_arithmetic_v<T>, bool> Read(T &value) {
+            if (failed_ || !SkipSpaces()) {
+                failed_ = true;
+                return false;
+            }
+            std::from_chars_result result = std::from_chars(current_, end_, value);
+            if (result.ec != std::errc()) {
+                failed_ = true;
+                return false;
+            }
+            current_ = result.ptr;
+            return true;
+        }
+
+        template <typename T>
+        bool Read(BasicVector<T> &v) {
+            return Read(v.x_) && Read(v.y_);
+        }
+
+        template <typename T>
+        bool Read(BasicLine<T> &line) {
+            return Read(line.A_) && Read(line.B_) && Read(line.C_);
+        }
+
+        template <typename T>
+        bool Read(BasicSegment<T> &segment) {
+            return Read(segment.a_) && Read(segment.b_);
+        }
+
+        template <typename T>
+        bool Read(BasicBeam<T> &beam) {
+            return Read(beam.a_) && Read(beam.b_);
+        }
+
+        /*!
+        Дописывает в out не больше count объектов, например чтобы обрабатывать большой файл
+        пачками фиксированного размера.
+        \param[out] out Куда дописывать прочитанное
+        \param[in] count Сколько объектов прочитать
+        \return Сколько объектов удалось прочитать
+        */
+        template <typename Object>
+        std::size_t Read(std::vector<Object> &out, std::size_t count) {
+            std::size_t read = 0;
+            Object object;
+            while (read < count && Read(object)) {
+                out.push_back(object);
+                ++read;
+            }
+            return read;
+        }
+
+        /*!
+        Дописывает в store не больше count фигур, каждая записана числом вершин и затем
+        самими вершинами. Вершины читаются сразу в массив хранилища, без промежуточных
+        векторов.
+        \param[out] store Куда дописывать прочитанное
+        \param[in] count Сколько фигур прочитать
+        \return Сколько фигур удалось прочитать целиком. Недочитанная фигура не добавляется
+        */
+        template <typename T>
+        std::size_t Read(BasicGeometryStore<T> &store, std::size_t count) {
+            std::size_t read = 0;
+            std::size_t size;
+            BasicVector<T> v;
+            while (read < count && Read(size)) {
+                for (std::size_t i = 0; i < size && Read(v); ++i) {
+                    store.PushVertex(v);
+                }
+                if (failed_) {
+                    store.DiscardShape();
+                    break;
+                }
+                store.CloseShape();
+                ++read;
+            }
+            return read;
+        }
+
+        //! true, если до конца буфера остались только пробельные символы
+        bool AtEnd() {
+            return !SkipSpaces();
+        }
+
+        //! true, если какое-то чтение не удалось
+        bool Failed() const {
+            return failed_;
+        }
+
+        //! Сколько байт ещё не прочитано
+        std::size_t Remaining() const {
+            return static_cast<std::size_t>(end_ - current_);
+        }
+
+    private:
+        bool SkipSpaces() {
+            while (current_ != end_ && (*current_ == ' ' || *current_ == '\n' ||
+                                        *current_ == '\r' || *current_ == '\t')) {
+                ++current_;
+            }
+            // std::from_chars, в отличие от operator>>, не принимает ведущий '+'.
+            if (current_ != end_ && *current_ == '+') {
+                ++current_;
+            }
+            return current_ != end_;
+        }
+
+        const char *current_;
+        const char *end_;
+        bool failed_ = false;
+    };
+
+    /*!
+    \brief Буферизованная запись чисел и объектов в поток. Числа с плавающей точкой
+    записываются кратчайшим представлением, которое читается обратно без потерь. Буфер
+    сбрасывается при заполнении, в Flush() и в деструкторе.
+    */
+    class FastWriter {
+    public:
+        explicit FastWriter(std::ostream &out, std::size_t buffer_size = 1 << 16)
+            : out_(&out), buffer_(buffer_size) {
+        }
+
+        FastWriter(const FastWriter &) = delete;
+
+        FastWriter &operator=(const FastWriter &) = delete;
+
+        ~FastWriter() {
+            Flush();
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_arithmetic_v<T>, FastWriter &> Write(T value) {
+            // Хватает на любое число, включая long double в научной записи.
+            constexpr std::size_t kMaxLength = 64;
+            Reserve(kMaxLength);
+            std::to_chars_result result =
+                    std::to_chars(buffer_.data() + size_, buffer_.data() + buffer_.size(), value);
+            size_ = static_cast<std::size_t>(result.ptr - buffer_.data());
+            return *this;
+        }
+
+        FastWriter &Write(char c) {
+            Reserve(1);
+            buffer_[size_++] = c;
+            return *this;
+        }
+
+        FastWriter &Write(std::string_view text) {
+            for (char c : text) {
+                Write(c);
+            }
+            return *this;
+        }
+
+        template <typename T>
+        FastWriter &Write(const BasicVector<T> &v) {
+            return Write(v.x_).Write(' ').Write(v.y_);
+        }
+
+        template <typename T>
+        FastWriter &Write(const BasicLine<T> &line) {
+            return Write(line.A_).Write(' ').Write(line.B_).Write(' ').Write(line.C_);
+        }
+
+        template <typename T>
+        FastWriter &Write(const BasicSegment<T> &segment) {
+            return Write(segment.a_).Write(' ').Write(segment.b_);
+        }
+
+        template <typename T>
+        FastWriter &Write(const BasicBeam<T> &beam) {
+            return Write(beam.a_).Write(' ').Write(beam.b_);
+        }
+
+        //! Число вершин и вершины через пробел, в формате Read для хранилища
+        template <typename T>
+        FastWriter &Write(const BasicShapeView<T> &shape) {
+            Write(shape.Size());
+            for (const BasicVector<T> &v : shape) {
+                Write(' ').Write(v);
+            }
+            return *this;
+        }
+
+        void Flush() {
+            out_->write(buffer_.data(), static_cast<std::streamsize>(size_));
+            size_ = 0;
+        }
+
+    private:
+        void Reserve(std::size_t length) {
+            if (buffer_.size() - size_ < length) {
+                Flush();
+                if (buffer_.size() < length) {
+                    buffer_.resize(length);
+                }
+            }
+        }
+
+        std::ostream *out_;
+        std::vector<char> buffer_;
+        std::size_t size_ = 0;
+    };
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_FAST_IO_H
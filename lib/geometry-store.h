@@ -0,0 +1,191 @@
+#ifndef OLYMP_GEOMETRY_GEOMETRY_STORE_H
+#define OLYMP_GEOMETRY_GEOMETRY_STORE_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "olymp-geometry.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Многоугольник или ломаная из хранилища: указатель на вершины подряд и их
+    количество. Действителен, пока хранилище не изменено.
+    */
+    template <typename T>
+    class BasicShapeView {
+    public:
+        BasicShapeView() = default;
+
+        BasicShapeView(const BasicVector<T> *data, std::size_t size) : data_(data), size_(size) {
+        }
+
+        std::size_t Size() const {
+            return size_;
+        }
+
+        bool Empty() const {
+            return size_ == 0;
+        }
+
+        const BasicVector<T> &operator[](std::size_t i) const {
+            return data_[i];
+        }
+
+        const BasicVector<T> *Data() const {
+            return data_;
+        }
+
+        const BasicVector<T> *begin() const {
+            return data_;
+        }
+
+        const BasicVector<T> *end() const {
+            return data_ + size_;
+        }
+
+    private:
+        const BasicVector<T> *data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    /*!
+    \brief Набор многоугольников или ломаных переменной длины в одном непрерывном массиве
+    вершин со смещениями: фигура i - вершины [Offsets()[i], Offsets()[i + 1]).
+
+    Вместо отдельного std::vector на каждую фигуру память берётся из std::pmr::memory_resource.
+    С std::pmr::monotonic_buffer_resource выделение - это сдвиг указателя, а вся память
+    пакета освобождается разом вместе с ресурсом. Clear() за O(1) сохраняет ёмкость, так что
+    при переиспользовании хранилища для пакетов не больше первого выделений нет вовсе.
+    \tparam T Тип координат
+    */
+    template <typename T>
+    class BasicGeometryStore {
+    public:
+        //! Хранилище можно класть в pmr-контейнеры, оно возьмёт их ресурс
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        BasicGeometryStore() : BasicGeometryStore(allocator_type()) {
+        }
+
+        //! Принимает и std::pmr::memory_resource *
+        explicit BasicGeometryStore(const allocator_type &allocator)
+            : vertices_(allocator), offsets_(1, 0, allocator) {
+        }
+
+        BasicGeometryStore(const BasicGeometryStore &other) = default;
+
+        BasicGeometryStore(BasicGeometryStore &&other) = default;
+
+        BasicGeometryStore(const BasicGeometryStore &other, const allocator_type &allocator)
+            : vertices_(other.vertices_, allocator), offsets_(other.offsets_, allocator) {
+        }
+
+        BasicGeometryStore(BasicGeometryStore &&other, const allocator_type &allocator)
+            : vertices_(std::move(other.vertices_), allocator),
+              offsets_(std::move(other.offsets_), allocator) {
+        }
+
+        BasicGeometryStore &operator=(const BasicGeometryStore &other) = default;
+
+        BasicGeometryStore &operator=(BasicGeometryStore &&other) = default;
+
+        //! Число фигур
+        std::size_t Size() const {
+            return offsets_.size() - 1;
+        }
+
+        bool Empty() const {
+            return Size() == 0;
+        }
+
+        //! Число вершин во всех фигурах, включая недописанную
+        std::size_t VertexCount() const {
+            return vertices_.size();
+        }
+
+        void Reserve(std::size_t shapes, std::size_t vertices) {
+            offsets_.reserve(shapes + 1);
+            vertices_.reserve(vertices);
+        }
+
+        //! Удаляет все фигуры за O(1), ёмкость сохраняется
+        void Clear() {
+            vertices_.clear();
+            offsets_.resize(1);
+        }
+
+        /*!
+        Дописывает вершину в конец недописанной фигуры, например при чтении вершин по одной.
+        Фигура появляется в хранилище после CloseShape().
+        */
+        template <typename U>
+        void PushVertex(const BasicVector<U> &v) {
+            vertices_.emplace_back(v);
+        }
+
+        /*!
+        Завершает фигуру из вершин, добавленных PushVertex после предыдущей фигуры.
+        \return Номер фигуры
+        */
+        std::size_t CloseShape() {
+            offsets_.push_back(vertices_.size());
+            return Size() - 1;
+        }
+
+        //! Удаляет вершины недописанной фигуры, например после ошибки чтения
+        void DiscardShape() {
+            vertices_.resize(offsets_.back());
+        }
+
+        /*!
+        Добавляет фигуру целиком.
+        \return Номер фигуры
+        */
+        template <typename Iterator>
+        std::size_t Add(Iterator begin, Iterator end) {
+            using Value = typename std::iterator_traits<Iterator>::value_type;
+            if constexpr (std::is_same_v<Value, BasicVector<T>>) {
+                vertices_.insert(vertices_.end(), begin, end);
+            } else {
+                for (; begin != end; ++begin) {
+                    vertices_.emplace_back(*begin);
+                }
+            }
+            return CloseShape();
+        }
+
+        template <typename Container>
+        std::size_t Add(const Container &shape) {
+            return Add(std::begin(shape), std::end(shape));
+        }
+
+        BasicShapeView<T> operator[](std::size_t i) const {
+            return {vertices_.data() + offsets_[i], offsets_[i + 1] - offsets_[i]};
+        }
+
+        const std::pmr::vector<BasicVector<T>> &Vertices() const {
+            return vertices_;
+        }
+
+        //! Size() + 1 смещений, первое равно 0
+        const std::pmr::vector<std::size_t> &Offsets() const {
+            return offsets_;
+        }
+
+        allocator_type get_allocator() const {
+            return vertices_.get_allocator();
+        }
+
+    private:
+        std::pmr::vector<BasicVector<T>> vertices_;
+        std::pmr::vector<std::size_t> offsets_;
+    };
+
+    using GeometryStore = BasicGeometryStore<double>;
+}
+
+#endif //OLYMP_GEOMETRY_GEOMETRY_STORE_H
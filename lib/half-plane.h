@@ -0,0 +1,190 @@
+#ifndef OLYMP_GEOMETRY_HALF_PLANE_H
+#define OLYMP_GEOMETRY_HALF_PLANE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "olymp-geometry.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Вид пересечения полуплоскостей.
+    */
+    enum class RegionKind {
+        kEmpty,
+        kBounded,
+        kUnbounded
+    };
+
+    /*!
+    \brief Пересечение полуплоскостей: выпуклый многоугольник.
+    */
+    template <typename T>
+    struct HalfPlaneRegion {
+        RegionKind kind_ = RegionKind::kEmpty;
+        //! Вершины против часовой стрелки без повторов. У вырожденной области - одна или две
+        std::vector<BasicVector<RealType<T>>> vertices_;
+    };
+
+    namespace detail {
+        // Направление границы полуплоскости, сама полуплоскость слева от него.
+        template <typename T>
+        BasicVector<T> BoundaryDirection(const BasicLine<T> &line) {
+            return BasicVector<T>(line.B_, -line.A_);
+        }
+
+        // Сторона прямой c, на которой лежит точка пересечения непараллельных a и b.
+        template <typename T>
+        int SideOfCrossing(const BasicLine<T> &a, const BasicLine<T> &b, const BasicLine<T> &c) {
+            return Determinant3Sign(a.A_, a.B_, a.C_, b.A_, b.B_, b.C_, c.A_, c.B_, c.C_) *
+                   DeterminantSign(a.A_, a.B_, b.A_, b.B_);
+        }
+
+        // Поворот от границы a к границе b меньше pi.
+        template <typename T>
+        bool TurnsLeft(const BasicLine<T> &a, const BasicLine<T> &b) {
+            return DeterminantSign(a.B_, -a.A_, b.B_, -b.A_) > 0;
+        }
+
+        // Из двух полуплоскостей с одинаковым направлением a уже, если C / |(A, B)| меньше.
+        // Нормали пропорциональны, поэтому вместо длины берётся больший по модулю
+        // коэффициент.
+        template <typename T>
+        bool Tighter(const BasicLine<T> &a, const BasicLine<T> &b) {
+            if (Abs(a.A_) >= Abs(a.B_)) {
+                return DeterminantSign(a.C_, b.C_, Abs(a.A_), Abs(b.A_)) < 0;
+            }
+            return DeterminantSign(a.C_, b.C_, Abs(a.B_), Abs(b.B_)) < 0;
+        }
+
+        // Сортирует полуплоскости по направлению границы и оставляет из одинаково
+        // направленных самую узкую.
+        template <typename T>
+        void SortHalfPlanes(std::vector<BasicLine<T>> &lines) {
+            auto less = [](const BasicLine<T> &a, const BasicLine<T> &b) {
+                return AngleLess(BoundaryDirection(a), BoundaryDirection(b));
+            };
+            std::sort(lines.begin(), lines.end(), [&less](const auto &a, const auto &b) {
+                return less(a, b) || (!less(b, a) && Tighter(a, b));
+            });
+            auto same = [&less](const BasicLine<T> &a, const BasicLine<T> &b) {
+                return !less(a, b) && !less(b, a);
+            };
+            lines.erase(std::unique(lines.begin(), lines.end(), same), lines.end());
+        }
+
+        template <typename T>
+        BasicVector<T> Crossing(const BasicLine<T> &a, const BasicLine<T> &b) {
+            T determinant = a.A_ * b.B_ - b.A_ * a.B_;
+            return BasicVector<T>((a.B_ * b.C_ - b.B_ * a.C_) / determinant,
+                                  (b.A_ * a.C_ - a.A_ * b.C_) / determinant);
+        }
+
+        // Пересечение полуплоскостей, упорядоченных SortHalfPlanes, у которых все повороты
+        // между соседними границами меньше pi. Возвращает границы области по порядку или
+        // пустой массив.
+        template <typename T>
+        std::vector<BasicLine<T>> HalfPlaneBoundary(const std::vector<BasicLine<T>> &lines) {
+            std::vector<BasicLine<T>> deque(lines.size());
+            std::size_t head = 0, tail = 0;
+            for (const BasicLine<T> &line : lines) {
+                while (tail - head >= 2 &&
+                       SideOfCrossing(deque[tail - 2], deque[tail - 1], line) < 0) {
+                    --tail;
+                }
+                while (tail - head >= 2 &&
+                       SideOfCrossing(deque[head], deque[head + 1], line) < 0) {
+                    ++head;
+                }
+                // Все границы между последней и новой выброшены: полуплоскости смотрят
+                // друг от друга и не пересекаются.
+                if (tail > head && !TurnsLeft(deque[tail - 1], line)) {
+                    return {};
+                }
+                deque[tail++] = line;
+            }
+            while (tail - head >= 3 &&
+                   SideOfCrossing(deque[tail - 2], deque[tail - 1], deque[head]) < 0) {
+                --tail;
+            }
+            while (tail - head >= 3 &&
+                   SideOfCrossing(deque[head], deque[head + 1], deque[tail - 1]) < 0) {
+                ++head;
+            }
+            if (tail - head < 3 || !TurnsLeft(deque[tail - 1], deque[head])) {
+                return {};
+            }
+            return std::vector<BasicLine<T>>(deque.begin() + head, deque.begin() + tail);
+        }
+    }
+
+    /*!
+    \defgroup half_plane Пересечение полуплоскостей
+    \ingroup intersection
+    \brief Пересечение полуплоскостей, заданных прямыми.
+    */
+    ///@{
+
+    /*!
+    Пересечение полуплоскостей за O(n log n): полуплоскости сортируются по направлению
+    границы, а затем обходятся с деком границ текущей области. Все решения принимаются
+    точными предикатами по коэффициентам прямых: порядок направлений - AngleLess, сторона
+    точки пересечения двух границ - Determinant3Sign, поэтому десятки тысяч почти
+    параллельных прямых не ломают область. Вершины вычисляются в RealType<T> только в конце.
+    \param[in] lines Прямые. Каждая задаёт полуплоскость A * x + B * y + C >= 0, то есть
+    точки, для которых SideOfLine >= 0 и которые OnSameSideEq с любой точкой, где
+    A * x + B * y + C > 0. Для BasicLine(a, b) это сторона справа от направления a -> b
+    \param[in] bound Неограниченная область заменяется своей частью в квадрате
+    |x|, |y| <= bound
+    \return Область. Ограниченность определяется по направлениям прямых точно, а
+    неограниченная область без точек в квадрате считается пустой
+    */
+    template <typename T>
+    HalfPlaneRegion<T> HalfPlaneIntersection(const std::vector<BasicLine<T>> &lines,
+                                             T bound = static_cast<T>(1'000'000'000)) {
+        using Line = BasicLine<RealType<T>>;
+        HalfPlaneRegion<T> region;
+        std::vector<Line> sorted;
+        sorted.reserve(lines.size() + 4);
+        for (const BasicLine<T> &line : lines) {
+            if (line.A_ != 0 || line.B_ != 0) {
+                sorted.emplace_back(line);
+            } else if (line.C_ < 0) {
+                return region;
+            }
+        }
+        detail::SortHalfPlanes(sorted);
+        bool bounded = sorted.size() >= 3;
+        for (std::size_t i = 0; bounded && i < sorted.size(); ++i) {
+            bounded = detail::TurnsLeft(sorted[i], sorted[i + 1 == sorted.size() ? 0 : i + 1]);
+        }
+        if (!bounded) {
+            RealType<T> b = bound;
+            sorted.insert(sorted.end(),
+                          {Line(1, 0, b), Line(0, 1, b), Line(-1, 0, b), Line(0, -1, b)});
+            detail::SortHalfPlanes(sorted);
+        }
+        std::vector<Line> boundary = detail::HalfPlaneBoundary(sorted);
+        std::size_t n = boundary.size();
+        if (n == 0) {
+            return region;
+        }
+        region.kind_ = bounded ? RegionKind::kBounded : RegionKind::kUnbounded;
+        // Вершина между границами i и i + 1 совпадает со следующей, если три границы
+        // проходят через одну точку.
+        for (std::size_t i = 0; i < n; ++i) {
+            const Line &a = boundary[i], &b = boundary[(i + 1) % n], &c = boundary[(i + 2) % n];
+            if (Determinant3Sign(a.A_, a.B_, a.C_, b.A_, b.B_, b.C_, c.A_, c.B_, c.C_) != 0) {
+                region.vertices_.push_back(detail::Crossing(a, b));
+            }
+        }
+        if (region.vertices_.empty()) {
+            region.vertices_.push_back(detail::Crossing(boundary[0], boundary[1]));
+        }
+        return region;
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_HALF_PLANE_H
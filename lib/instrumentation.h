@@ -0,0 +1,355 @@
+#ifndef OLYMP_GEOMETRY_INSTRUMENTATION_H
+#define OLYMP_GEOMETRY_INSTRUMENTATION_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#include "predicates.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define OLYMP_GEOMETRY_RDTSC 1
+#include <x86intrin.h>
+#else
+#define OLYMP_GEOMETRY_RDTSC 0
+#include <chrono>
+#endif
+
+// Без OLYMP_GEOMETRY_INSTRUMENTATION макросы раскрываются в пустое выражение, и горячие
+// функции компилируются так же, как без этого заголовка.
+#ifdef OLYMP_GEOMETRY_INSTRUMENTATION
+#define OLYMP_GEOMETRY_COUNT(probe) \
+    ::olymp_geometry::detail::CountProbe(::olymp_geometry::Probe::probe)
+#ifdef OLYMP_GEOMETRY_INSTRUMENTATION_CYCLES
+#define OLYMP_GEOMETRY_TIME(probe) \
+    ::olymp_geometry::detail::ProbeTimer olymp_geometry_probe_timer( \
+            ::olymp_geometry::Probe::probe)
+#else
+#define OLYMP_GEOMETRY_TIME(probe) OLYMP_GEOMETRY_COUNT(probe)
+#endif
+#else
+#define OLYMP_GEOMETRY_COUNT(probe) static_cast<void>(0)
+#define OLYMP_GEOMETRY_TIME(probe) static_cast<void>(0)
+#endif
+
+namespace olymp_geometry {
+    /*!
+    \defgroup instrumentation Счётчики горячих путей
+    \brief Сколько раз вызывались основные предикаты и по каким ветвям они пошли: общий
+    конец, вырожденный отрезок, совпадающие прямые, попадание в полосу kEps. По этим числам
+    видно, где окупаются точные предикаты и пакетные SIMD-функции.
+
+    Счётчики включаются макросом OLYMP_GEOMETRY_INSTRUMENTATION, а макрос
+    OLYMP_GEOMETRY_INSTRUMENTATION_CYCLES добавляет время вызовов в тактах rdtsc (вне x86 - в
+    наносекундах steady_clock) для функций, которые не constexpr: Intersect и Intersection
+    для отрезков и Dist. У constexpr-функций считаются только вызовы. Без макроса точки
+    замера исчезают при компиляции, а функции этого модуля возвращают нули. Как и
+    OLYMP_GEOMETRY_EXACT_PREDICATES, макросы должны быть одинаковыми во всех единицах
+    трансляции программы.
+
+    Каждый поток пишет в свои счётчики без блокировок, TakeInstrumentationSnapshot()
+    складывает их по всем потокам, включая завершившиеся. Вызовы из других функций
+    библиотеки тоже считаются, например LiesOn внутри Intersect. При вычислении на этапе
+    компиляции счётчики не меняются. Для целых координат полоса kEps - это сама прямая, а с
+    точными предикатами ветви полосы не считаются вовсе.
+    */
+    ///@{
+
+    /*!
+    Точки замера. Для ветвей считается число попаданий, для функций - число вызовов.
+    */
+    enum class Probe {
+        //! Вызовы Intersect для двух отрезков
+        kIntersectSegments,
+        //! У отрезков есть равный конец
+        kIntersectSharedEndpoint,
+        //! Один из отрезков - точка
+        kIntersectDegenerate,
+        //! Отрезки на одной прямой: по сравнению прямых, с точными предикатами - по нулевым
+        //! ориентациям концов второго отрезка
+        kIntersectCollinear,
+        //! Ответ дали знаки по разные стороны от прямых
+        kIntersectGeneral,
+        //! С точными предикатами: конец одного отрезка на прямой другого, но не на одной
+        //! прямой целиком
+        kIntersectZeroOrientation,
+        //! Вызовы LiesOn для отрезка
+        kLiesOnSegment,
+        //! Точка попала в полосу kEps вокруг прямой отрезка
+        kLiesOnEpsBand,
+        //! Вызовы OnSameSideEq
+        kOnSameSideEq,
+        //! Хотя бы одна из точек в полосе kEps вокруг прямой
+        kOnSameSideEqEpsBand,
+        //! Вызовы OnSameSide
+        kOnSameSide,
+        //! Хотя бы одна из точек в полосе kEps вокруг прямой
+        kOnSameSideEpsBand,
+        //! Вызовы SideOfLine для BasicLine
+        kSideOfLine,
+        //! Вызовы IsBetween
+        kIsBetween,
+        //! Вызовы Dist от точки до прямой
+        kDistLine,
+        //! Вызовы Dist от точки до отрезка
+        kDistSegment,
+        //! Вызовы DistSquared от точки до прямой
+        kDistSquaredLine,
+        //! Вызовы DistSquared от точки до отрезка
+        kDistSquaredSegment,
+        //! Вызовы Intersection для двух отрезков
+        kIntersectionSegments
+    };
+
+    constexpr std::size_t kProbeCount =
+            static_cast<std::size_t>(Probe::kIntersectionSegments) + 1;
+
+    //! true, если программа собрана с OLYMP_GEOMETRY_INSTRUMENTATION
+#ifdef OLYMP_GEOMETRY_INSTRUMENTATION
+    constexpr bool kInstrumentationEnabled = true;
+#else
+    constexpr bool kInstrumentationEnabled = false;
+#endif
+
+    //! true, если кроме числа вызовов замеряется время
+#if defined(OLYMP_GEOMETRY_INSTRUMENTATION) && defined(OLYMP_GEOMETRY_INSTRUMENTATION_CYCLES)
+    constexpr bool kInstrumentationCycles = true;
+#else
+    constexpr bool kInstrumentationCycles = false;
+#endif
+
+    /*!
+    \return Имя точки замера в JSON, например "intersect_segments.collinear"
+    */
+    inline const char *ProbeName(Probe probe) {
+        static constexpr const char *kNames[kProbeCount] = {
+                "intersect_segments",
+                "intersect_segments.shared_endpoint",
+                "intersect_segments.degenerate",
+                "intersect_segments.collinear",
+                "intersect_segments.general",
+                "intersect_segments.zero_orientation",
+                "lies_on_segment",
+                "lies_on_segment.eps_band",
+                "on_same_side_eq",
+                "on_same_side_eq.eps_band",
+                "on_same_side",
+                "on_same_side.eps_band",
+                "side_of_line",
+                "is_between",
+                "dist_line",
+                "dist_segment",
+                "dist_squared_line",
+                "dist_squared_segment",
+                "intersection_segments",
+        };
+        return kNames[static_cast<std::size_t>(probe)];
+    }
+
+    /*!
+    \brief Значения всех счётчиков на момент снимка.
+    */
+    struct InstrumentationSnapshot {
+        std::array<uint64_t, kProbeCount> calls_{};
+        //! Суммарное время, пусто без OLYMP_GEOMETRY_INSTRUMENTATION_CYCLES
+        std::array<uint64_t, kProbeCount> cycles_{};
+
+        uint64_t Calls(Probe probe) const {
+            return calls_[static_cast<std::size_t>(probe)];
+        }
+
+        uint64_t Cycles(Probe probe) const {
+            return cycles_[static_cast<std::size_t>(probe)];
+        }
+    };
+
+    /*!
+    Разность снимков - счётчики участка кода между ними.
+    */
+    inline InstrumentationSnapshot operator-(const InstrumentationSnapshot &after,
+                                             const InstrumentationSnapshot &before) {
+        InstrumentationSnapshot result;
+        for (std::size_t i = 0; i < kProbeCount; ++i) {
+            result.calls_[i] = after.calls_[i] - before.calls_[i];
+            result.cycles_[i] = after.cycles_[i] - before.cycles_[i];
+        }
+        return result;
+    }
+
+    namespace detail {
+        struct ProbeCounters {
+            std::atomic<uint64_t> calls_[kProbeCount] = {};
+            std::atomic<uint64_t> cycles_[kProbeCount] = {};
+        };
+
+        // Пишет только поток-владелец, поэтому хватает load и store без атомарного
+        // сложения. Другие потоки только читают.
+        inline void AddTo(std::atomic<uint64_t> &counter, uint64_t value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value,
+                          std::memory_order_relaxed);
+        }
+
+        // Счётчики живых потоков и сумма по завершившимся.
+        class ProbeRegistry {
+        public:
+            void Attach(ProbeCounters *counters) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                live_.push_back(counters);
+            }
+
+            void Detach(ProbeCounters *counters) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                Accumulate(*counters, retired_);
+                live_.erase(std::find(live_.begin(), live_.end(), counters));
+            }
+
+            InstrumentationSnapshot Snapshot() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                InstrumentationSnapshot result = retired_;
+                for (const ProbeCounters *counters : live_) {
+                    Accumulate(*counters, result);
+                }
+                return result;
+            }
+
+            void Reset() {
+                std::lock_guard<std::mutex> lock(mutex_);
+                retired_ = InstrumentationSnapshot();
+                for (ProbeCounters *counters : live_) {
+                    for (std::size_t i = 0; i < kProbeCount; ++i) {
+                        counters->calls_[i].store(0, std::memory_order_relaxed);
+                        counters->cycles_[i].store(0, std::memory_order_relaxed);
+                    }
+                }
+            }
+
+        private:
+            static void Accumulate(const ProbeCounters &counters, InstrumentationSnapshot &out) {
+                for (std::size_t i = 0; i < kProbeCount; ++i) {
+                    out.calls_[i] += counters.calls_[i].load(std::memory_order_relaxed);
+                    out.cycles_[i] += counters.cycles_[i].load(std::memory_order_relaxed);
+                }
+            }
+
+            std::mutex mutex_;
+            std::vector<ProbeCounters *> live_;
+            InstrumentationSnapshot retired_;
+        };
+
+        inline ProbeRegistry &Probes() {
+            static ProbeRegistry registry;
+            return registry;
+        }
+
+        // Регистрируется при первом замере в потоке и отдаёт свои числа при его
+        // завершении. Реестр создаётся раньше, поэтому и разрушается позже.
+        struct ThreadProbes {
+            ThreadProbes() {
+                Probes().Attach(&counters_);
+            }
+
+            ~ThreadProbes() {
+                Probes().Detach(&counters_);
+            }
+
+            ProbeCounters counters_;
+        };
+
+        inline ProbeCounters &LocalProbes() {
+            thread_local ThreadProbes probes;
+            return probes.counters_;
+        }
+
+        constexpr void CountProbe(Probe probe) {
+#if defined(__GNUC__) || defined(__clang__)
+            if (__builtin_is_constant_evaluated()) {
+                return;
+            }
+#endif
+            AddTo(LocalProbes().calls_[static_cast<std::size_t>(probe)], 1);
+        }
+
+        inline uint64_t ReadCycleCounter() {
+#if OLYMP_GEOMETRY_RDTSC
+            return __rdtsc();
+#else
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now().time_since_epoch())
+                    .count();
+#endif
+        }
+
+        // Считает вызов и время до конца области видимости, вложенные замеры входят во
+        // время внешнего.
+        class ProbeTimer {
+        public:
+            explicit ProbeTimer(Probe probe) : probe_(probe) {
+                CountProbe(probe);
+                start_ = ReadCycleCounter();
+            }
+
+            ProbeTimer(const ProbeTimer &) = delete;
+
+            ProbeTimer &operator=(const ProbeTimer &) = delete;
+
+            ~ProbeTimer() {
+                uint64_t elapsed = ReadCycleCounter() - start_;
+                AddTo(LocalProbes().cycles_[static_cast<std::size_t>(probe_)], elapsed);
+            }
+
+        private:
+            Probe probe_;
+            uint64_t start_ = 0;
+        };
+    }
+
+    /*!
+    Складывает счётчики всех потоков. Можно вызывать во время работы других потоков, тогда
+    снимок содержит часть их последних замеров.
+    */
+    inline InstrumentationSnapshot TakeInstrumentationSnapshot() {
+        return detail::Probes().Snapshot();
+    }
+
+    /*!
+    Обнуляет счётчики всех потоков. Замеры, идущие в других потоках одновременно со сбросом,
+    могут его пережить, поэтому сбрасывать стоит между пакетами работы.
+    */
+    inline void ResetInstrumentation() {
+        detail::Probes().Reset();
+    }
+
+    /*!
+    Пишет снимок в виде JSON-объекта:
+    {"enabled": ..., "cycles": ..., "clock": "rdtsc" или "steady_clock_ns",
+    "exact_fallbacks": ExactFallbackCount(), "probes": {"<ProbeName>": {"calls": ...,
+    "cycles": ...}, ...}}.
+    \param[out] out Поток вывода
+    \param[in] snapshot Снимок, например TakeInstrumentationSnapshot()
+    */
+    inline void WriteInstrumentationJson(std::ostream &out,
+                                         const InstrumentationSnapshot &snapshot) {
+        out << "{\n";
+        out << "  \"enabled\": " << (kInstrumentationEnabled ? "true" : "false") << ",\n";
+        out << "  \"cycles\": " << (kInstrumentationCycles ? "true" : "false") << ",\n";
+        out << "  \"clock\": \"" << (OLYMP_GEOMETRY_RDTSC ? "rdtsc" : "steady_clock_ns")
+            << "\",\n";
+        out << "  \"exact_fallbacks\": " << ExactFallbackCount() << ",\n";
+        out << "  \"probes\": {\n";
+        for (std::size_t i = 0; i < kProbeCount; ++i) {
+            out << "    \"" << ProbeName(static_cast<Probe>(i)) << "\": {\"calls\": "
+                << snapshot.calls_[i] << ", \"cycles\": " << snapshot.cycles_[i] << "}"
+                << (i + 1 < kProbeCount ? ",\n" : "\n");
+        }
+        out << "  }\n";
+        out << "}\n";
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_INSTRUMENTATION_H
@@ -3,121 +3,314 @@
 
 #include <iostream>
 #include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <optional>
+#include <type_traits>
 
-namespace olymp_geometry {
-    const long double kEps = 0.00000001;
-
-    class Vector {
-    public:
-        long double x_, y_;
+#include "instrumentation.h"
+#include "predicates.h"
 
-        Vector();
+namespace olymp_geometry {
+    constexpr long double kEps = 0.00000001;
 
-        Vector(long double x, long double y);
+    /*!
+    Тип, в котором считаются длины, углы и расстояния для координат типа T:
+    сам T для чисел с плавающей точкой и long double для целочисленных координат.
+    */
+    template <typename T>
+    using RealType = std::conditional_t<std::is_floating_point_v<T>, T, long double>;
 
-        Vector(std::istream &in);
-        // Functions:
+    /*!
+    Точность сравнений для координат типа T. Для float берётся 1e-5, так как kEps меньше
+    его машинной точности, для double и long double - kEps. Для целочисленных координат
+    точность равна 0.5, то есть все сравнения становятся точными.
+    */
+    template <typename T>
+    constexpr RealType<T> kEpsOf = static_cast<RealType<T>>(
+            std::is_integral_v<T> ? 0.5L : (std::is_same_v<T, float> ? 0.00001L : kEps));
+
+    namespace detail {
+        // std::abs не constexpr до C++23.
+        template <typename T>
+        constexpr T Abs(T x) {
+            return x < 0 ? -x : x;
+        }
+    }
 
-        long double Length() const;
+    /*!
+    \brief Вектор (точка) на плоскости.
+    \tparam T Тип координат: float, double, long double или int64_t. Для long double
+    есть синоним Vector, аналогично для остальных классов.
+    */
+    template <typename T>
+    class BasicVector {
+    public:
+        T x_, y_;
 
-        Vector GetPerpendicular() const;
+        constexpr BasicVector() : x_(0), y_(0) {
+        }
 
-        // OPERATORS:
+        constexpr BasicVector(T x, T y) : x_(x), y_(y) {
+        }
 
-        void operator+=(const Vector &other);
+        template <typename U>
+        constexpr explicit BasicVector(const BasicVector<U> &other)
+            : x_(static_cast<T>(other.x_)), y_(static_cast<T>(other.y_)) {
+        }
 
-        void operator+=(Vector &&other);
+        BasicVector(std::istream &in) {
+            in >> x_ >> y_;
+        }
 
-        void operator-=(const Vector &other);
+        // Functions:
 
-        void operator-=(Vector &&other);
+        RealType<T> Length() const {
+            return std::sqrt(static_cast<RealType<T>>(x_ * x_ + y_ * y_));
+        }
 
-        friend Vector operator+(const Vector &a, const Vector &b);
+        constexpr BasicVector GetPerpendicular() const {
+            return {y_, -x_};
+        }
 
-        friend Vector operator+(const Vector &a, Vector &&b);
+        // OPERATORS:
 
-        friend Vector operator+(Vector &&a, Vector &&b);
+        constexpr void operator+=(const BasicVector &other) {
+            x_ += other.x_;
+            y_ += other.y_;
+        }
 
-        friend Vector operator-(const Vector &a, const Vector &b);
+        constexpr void operator-=(const BasicVector &other) {
+            x_ -= other.x_;
+            y_ -= other.y_;
+        }
+    };
 
-        friend Vector operator-(const Vector &a, Vector &&b);
+    template <typename T>
+    constexpr BasicVector<T> operator+(const BasicVector<T> &a, const BasicVector<T> &b) {
+        return {a.x_ + b.x_, a.y_ + b.y_};
+    }
+
+    template <typename T>
+    constexpr BasicVector<T> operator-(const BasicVector<T> &a, const BasicVector<T> &b) {
+        return {a.x_ - b.x_, a.y_ - b.y_};
+    }
+
+    template <typename T>
+    std::istream &operator>>(std::istream &in, BasicVector<T> &v) {
+        in >> v.x_ >> v.y_;
+        return in;
+    }
+
+    template <typename T>
+    std::ostream &operator<<(std::ostream &out, const BasicVector<T> &v) {
+        out << v.x_ << " " << v.y_;
+        return out;
+    }
+
+    template <typename T>
+    constexpr bool operator==(const BasicVector<T> &a, const BasicVector<T> &b) {
+        return (detail::Abs(b.x_ - a.x_) < kEpsOf<T> && detail::Abs(b.y_ - a.y_) < kEpsOf<T>);
+    }
+
+    template <typename T>
+    class BasicLine {
+    public:
+        T A_, B_, C_;
 
-        friend Vector operator-(Vector &&a, Vector &&b);
+        constexpr BasicLine() : A_(1), B_(-1), C_(0) {
+        }
 
-        friend std::istream &operator>>(std::istream &in, Vector &v);
+        constexpr BasicLine(T a, T b, T c) : A_(a), B_(b), C_(c) {
+        }
 
-        friend std::istream &operator>>(std::istream &in, Vector &&v);
+        template <typename U>
+        constexpr explicit BasicLine(const BasicLine<U> &other)
+            : A_(static_cast<T>(other.A_)), B_(static_cast<T>(other.B_)),
+              C_(static_cast<T>(other.C_)) {
+        }
 
-        friend std::ostream &operator<<(std::ostream &out, const Vector &v);
+        BasicLine(std::istream &in) {
+            in >> A_ >> B_ >> C_;
+        }
 
-        friend std::ostream &operator<<(std::ostream &out, Vector &&v);
+        constexpr BasicLine(const BasicVector<T> &a, const BasicVector<T> &b)
+            : A_(b.y_ - a.y_), B_(a.x_ - b.x_), C_(-(A_ * a.x_ + B_ * a.y_)) {
+            // (A_, B_) = (b - a).GetPerpendicular()
+        }
 
-        friend bool operator==(const Vector &a, const Vector &b);
+        constexpr BasicVector<T> GetNormal() const {
+            return BasicVector<T>(A_, B_);
+        }
+    };
 
-        friend bool operator==(const Vector &a, Vector &&b);
+    template <typename T>
+    std::istream &operator>>(std::istream &in, BasicLine<T> &line) {
+        in >> line.A_ >> line.B_ >> line.C_;
+        return in;
+    }
+
+    template <typename T>
+    std::ostream &operator<<(std::ostream &out, const BasicLine<T> &line) {
+        out << line.A_ << " " << line.B_ << " " << line.C_;
+        return out;
+    }
+
+    template <typename T>
+    constexpr bool operator==(const BasicLine<T> &a, const BasicLine<T> &b) {
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+        if constexpr (std::is_floating_point_v<T>) {
+            return DeterminantSign(a.A_, a.B_, b.A_, b.B_) == 0 &&
+                   DeterminantSign(a.B_, a.C_, b.B_, b.C_) == 0 &&
+                   DeterminantSign(a.A_, a.C_, b.A_, b.C_) == 0;
+        }
+#endif
+        // Третья проверка нужна для вертикальных прямых, у которых B_ = 0.
+        return (detail::Abs(a.A_ * b.B_ - b.A_ * a.B_) < kEpsOf<T> &&
+                detail::Abs(a.B_ * b.C_ - b.B_ * a.C_) < kEpsOf<T> &&
+                detail::Abs(a.A_ * b.C_ - b.A_ * a.C_) < kEpsOf<T>);
+    }
 
-        friend bool operator==(Vector &&a, Vector &&b);
+    /*!
+    \brief Прямая A*x + B*y + C = 0 с единичной нормалью (A, B). Значение A*x + B*y + C
+    для такой прямой - это ориентированное расстояние, поэтому Dist, SideOfLine и Project
+    обходятся без корня и деления: корень извлекается один раз при построении.
+    \tparam T Тип координат точек. Коэффициенты хранятся в RealType<T>
+    */
+    template <typename T>
+    class BasicNormalizedLine {
+    public:
+        RealType<T> A_, B_, C_;
+
+        BasicNormalizedLine() : BasicNormalizedLine(BasicLine<T>()) {
+        }
+
+        //! line не должна быть вырожденной: (A, B) != (0, 0)
+        explicit BasicNormalizedLine(const BasicLine<T> &line) {
+            RealType<T> inverse = 1 / line.GetNormal().Length();
+            A_ = line.A_ * inverse;
+            B_ = line.B_ * inverse;
+            C_ = line.C_ * inverse;
+        }
+
+        BasicNormalizedLine(const BasicVector<T> &a, const BasicVector<T> &b)
+            : BasicNormalizedLine(BasicLine<T>(a, b)) {
+        }
+
+        constexpr BasicVector<RealType<T>> GetNormal() const {
+            return BasicVector<RealType<T>>(A_, B_);
+        }
     };
 
-    class Line {
-    public:
-        long double A_, B_, C_;
+    template <typename T>
+    std::ostream &operator<<(std::ostream &out, const BasicNormalizedLine<T> &line) {
+        out << line.A_ << " " << line.B_ << " " << line.C_;
+        return out;
+    }
 
-        Line();
+    template <typename T>
+    class BasicBeam {
+    public:
+        BasicVector<T> a_, b_;
 
-        Line(long double a, long double b, long double c);
+        constexpr BasicBeam() : a_(0, 0), b_(1, 1) {
+        }
 
-        Line(std::istream &in);
+        constexpr BasicBeam(const BasicVector<T> &a, const BasicVector<T> &b) : a_(a), b_(b) {
+        }
 
-        Line(const Vector &a, const Vector &b);
+        template <typename U>
+        constexpr explicit BasicBeam(const BasicBeam<U> &other) : a_(other.a_), b_(other.b_) {
+        }
 
-        Vector GetNormal() const;
+        BasicBeam(std::istream &in) {
+            in >> a_ >> b_;
+        }
+    };
 
-        friend std::istream &operator>>(std::istream &in, Line &line);
+    template <typename T>
+    std::istream &operator>>(std::istream &in, BasicBeam<T> &v) {
+        in >> v.a_ >> v.b_;
+        return in;
+    }
 
-        friend std::istream &operator>>(std::istream &in, Line &&line);
+    template <typename T>
+    std::ostream &operator<<(std::ostream &out, const BasicBeam<T> &v) {
+        out << v.a_ << " " << v.b_;
+        return out;
+    }
 
-        friend std::ostream &operator<<(std::ostream &out, const Line &line);
+    template <typename T>
+    class BasicSegment {
+    public:
+        BasicVector<T> a_, b_;
 
-        friend std::ostream &operator<<(std::ostream &out, Line &&line);
+        constexpr BasicSegment() : a_(0, 0), b_(1, 1) {
+        }
 
-        friend bool operator==(const Line &a, const Line &b);
+        constexpr BasicSegment(const BasicVector<T> &a, const BasicVector<T> &b) : a_(a), b_(b) {
+        }
 
-        friend bool operator==(const Line &a, Line &&b);
+        template <typename U>
+        constexpr explicit BasicSegment(const BasicSegment<U> &other)
+            : a_(other.a_), b_(other.b_) {
+        }
 
-        friend bool operator==(Line &&a, Line &&b);
+        BasicSegment(std::istream &in) {
+            in >> a_ >> b_;
+        }
     };
 
-    class Beam {
-    public:
-        Vector a_, b_;
+    template <typename T>
+    std::istream &operator>>(std::istream &in, BasicSegment<T> &v) {
+        in >> v.a_ >> v.b_;
+        return in;
+    }
 
-        Beam();
+    template <typename T>
+    std::ostream &operator<<(std::ostream &out, const BasicSegment<T> &v) {
+        out << v.a_ << " " << v.b_;
+        return out;
+    }
 
-        Beam(const Vector &a, const Vector &b);
-
-        Beam(std::istream &in);
-
-        friend std::istream &operator>>(std::istream &in, Beam &v);
-
-        friend std::istream &operator>>(std::istream &in, Beam &&v);
-    };
-
-    class Segment {
+    /*!
+    \brief Круг с центром center_ и радиусом radius_.
+    */
+    template <typename T>
+    class BasicCircle {
     public:
-        Vector a_, b_;
-
-        Segment();
+        BasicVector<T> center_;
+        T radius_;
 
-        Segment(const Vector &a, const Vector &b);
+        constexpr BasicCircle() : center_(0, 0), radius_(0) {
+        }
 
-        Segment(std::istream &in);
+        constexpr BasicCircle(const BasicVector<T> &center, T radius)
+            : center_(center), radius_(radius) {
+        }
 
-        friend std::istream &operator>>(std::istream &in, Segment &v);
+        template <typename U>
+        constexpr explicit BasicCircle(const BasicCircle<U> &other)
+            : center_(other.center_), radius_(static_cast<T>(other.radius_)) {
+        }
 
-        friend std::istream &operator>>(std::istream &in, Segment &&v);
+        BasicCircle(std::istream &in) {
+            in >> center_ >> radius_;
+        }
     };
 
+    template <typename T>
+    std::istream &operator>>(std::istream &in, BasicCircle<T> &circle) {
+        in >> circle.center_ >> circle.radius_;
+        return in;
+    }
+
+    template <typename T>
+    std::ostream &operator<<(std::ostream &out, const BasicCircle<T> &circle) {
+        out << circle.center_ << " " << circle.radius_;
+        return out;
+    }
+
     /*!
     \defgroup vector_multiplication Умножение векторов
     \brief Предоставляет скалярное и векторное умножение над векторами.
@@ -130,11 +323,10 @@ namespace olymp_geometry {
     \brief Скалярное умножение.
     */
     ///@{
-    long double ScalarMultiplication(const Vector &a, const Vector &b);
-
-    long double ScalarMultiplication(const Vector &a, Vector &&b);
-
-    long double ScalarMultiplication(Vector &&a, Vector &&b);
+    template <typename T>
+    constexpr T ScalarMultiplication(const BasicVector<T> &a, const BasicVector<T> &b) {
+        return a.x_ * b.x_ + a.y_ * b.y_;
+    }
     ///@}
 
     /*!
@@ -143,13 +335,10 @@ namespace olymp_geometry {
     \brief Векторное умножение.
     */
     ///@{
-    long double VectorMultiplication(const Vector &a, const Vector &b);
-
-    long double VectorMultiplication(const Vector &a, Vector &&b);
-
-    long double VectorMultiplication(Vector &&a, const Vector &b);
-
-    long double VectorMultiplication(Vector &&a, Vector &&b);
+    template <typename T>
+    constexpr T VectorMultiplication(const BasicVector<T> &a, const BasicVector<T> &b) {
+        return a.x_ * b.y_ - a.y_ * b.x_;
+    }
     ///@}
     ///@}
 
@@ -165,11 +354,10 @@ namespace olymp_geometry {
     \param[in] b Второй вектор
     \return Косинус угла между a и b
     */
-    long double AngleCos(const Vector &a, const Vector &b);
-
-    long double AngleCos(const Vector &a, Vector &&b);
-
-    long double AngleCos(Vector &&a, Vector &&b);
+    template <typename T>
+    RealType<T> AngleCos(const BasicVector<T> &a, const BasicVector<T> &b) {
+        return ScalarMultiplication(a, b) / a.Length() / b.Length();
+    }
 
     /*!
     Даёт угол между векторами через скалярное умножение.
@@ -177,27 +365,28 @@ namespace olymp_geometry {
     \param[in] b Второй вектор
     \return Угол между a и b в радианах
     */
-
-    long double Angle(const Vector &a, const Vector &b);
-
-    long double Angle(const Vector &a, Vector &&b);
-
-    long double Angle(Vector &&a, Vector &&b);
+    template <typename T>
+    RealType<T> Angle(const BasicVector<T> &a, const BasicVector<T> &b) {
+        return std::acos(AngleCos(a, b));
+    }
 
     /*!
     Переводит угол из градусов в радианы.
     \param[in] x Значение угла в градусах
     \return Значение угла в радианах
     */
-
-    long double DegToRad(long double x);
+    constexpr long double DegToRad(long double x) {
+        return x * M_PI / 180.0;
+    }
 
     /*!
     Переводит угол из радианов в градусы.
     \param[in] x Значение угла в радианах
     \return Значение угла в градусах
     */
-    long double RadToDeg(long double x);
+    constexpr long double RadToDeg(long double x) {
+        return x * 180.0 / M_PI;
+    }
 
     /*!
     \ingroup angles
@@ -207,22 +396,60 @@ namespace olymp_geometry {
     \param[in] m Проверяемый вектор - m
     \return true, если m находится между a и b, false в ином случае
     */
+    template <typename T>
+    constexpr bool IsBetween(const BasicVector<T> &a, const BasicVector<T> &b,
+                             const BasicVector<T> &m) {
+        OLYMP_GEOMETRY_COUNT(kIsBetween);
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+        if constexpr (std::is_floating_point_v<T>) {
+            int bm = DeterminantSign(b.x_, b.y_, m.x_, m.y_);
+            int ma = DeterminantSign(m.x_, m.y_, a.x_, a.y_);
+            return (bm >= 0 && ma >= 0) || (bm <= 0 && ma <= 0);
+        }
+#endif
+        T bm = VectorMultiplication(b, m);
+        T ma = VectorMultiplication(m, a);
+        if ((bm >= -kEpsOf<T> && ma >= -kEpsOf<T>) || (bm <= kEpsOf<T> && ma <= kEpsOf<T>)) {
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    namespace detail {
+        // 0 для нулевого вектора, 1 для углов [0, pi), 2 для [pi, 2 * pi).
+        template <typename T>
+        constexpr int AngleHalf(const BasicVector<T> &v) {
+            if (v.y_ > 0 || (v.y_ == 0 && v.x_ > 0)) {
+                return 1;
+            }
+            return v.x_ == 0 && v.y_ == 0 ? 0 : 2;
+        }
+    }
 
-    bool IsBetween(const Vector &a, const Vector &b, const Vector &m);
-
-    bool IsBetween(const Vector &a, const Vector &b, Vector &&m);
-
-    bool IsBetween(const Vector &a, Vector &&b, const Vector &m);
-
-    bool IsBetween(const Vector &a, Vector &&b, Vector &&m);
-
-    bool IsBetween(Vector &&a, const Vector &b, const Vector &m);
-
-    bool IsBetween(Vector &&a, const Vector &b, Vector &&m);
-
-    bool IsBetween(Vector &&a, Vector &&b, const Vector &m);
-
-    bool IsBetween(Vector &&a, Vector &&b, Vector &&m);
+    /*!
+    \ingroup angles
+    Сравнивает векторы по полярному углу в [0, 2 * pi), отсчитанному от оси x против часовой
+    стрелки, без acos и atan2: сначала по полуплоскости, затем по знаку
+    VectorMultiplication. Знак для чисел с плавающей точкой считается точно, как в IsBetween
+    с OLYMP_GEOMETRY_EXACT_PREDICATES, поэтому сравнение - строгий слабый порядок и
+    годится для std::sort. Нулевой вектор меньше всех, сонаправленные векторы равны.
+    \param[in] a Первый вектор
+    \param[in] b Второй вектор
+    \return true, если угол a меньше угла b
+    */
+    template <typename T>
+    constexpr bool AngleLess(const BasicVector<T> &a, const BasicVector<T> &b) {
+        int half_a = detail::AngleHalf(a), half_b = detail::AngleHalf(b);
+        if (half_a != half_b) {
+            return half_a < half_b;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            return DeterminantSign(a.x_, a.y_, b.x_, b.y_) > 0;
+        } else {
+            return VectorMultiplication(a, b) > 0;
+        }
+    }
     ///@}
 
     /*!
@@ -237,58 +464,413 @@ namespace olymp_geometry {
     \brief Содержит методы позволяющие узнать, принадлежит ли один объект другому.
     */
     ///@{
-    bool LiesOn(const Segment &segment, const Vector &v);
-
-    bool LiesOn(const Segment &segment, Vector &&v);
-
-    bool LiesOn(Segment &&segment, const Vector &v);
+    /*!
+    Проверяет, лежит ли точка на отрезке: на расстоянии меньше kEpsOf<T> от его прямой и
+    между концами. Считается только через скалярное и векторное произведения.
+    \param[in] segment Отрезок
+    \param[in] v Точка
+    \return true, если v лежит на segment
+    */
+    template <typename T>
+    constexpr bool LiesOn(const BasicSegment<T> &segment, const BasicVector<T> &v) {
+        OLYMP_GEOMETRY_COUNT(kLiesOnSegment);
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+        if constexpr (std::is_floating_point_v<T>) {
+            // Точка на прямой отрезка лежит на нём, если попадает в его ограничивающий
+            // прямоугольник. Вырожденный отрезок тоже обрабатывается верно.
+            return Orient2D(segment.a_.x_, segment.a_.y_, segment.b_.x_, segment.b_.y_, v.x_,
+                            v.y_) == 0 &&
+                   std::min(segment.a_.x_, segment.b_.x_) <= v.x_ &&
+                   v.x_ <= std::max(segment.a_.x_, segment.b_.x_) &&
+                   std::min(segment.a_.y_, segment.b_.y_) <= v.y_ &&
+                   v.y_ <= std::max(segment.a_.y_, segment.b_.y_);
+        }
+#endif
+        if (segment.a_ == v || segment.b_ == v) {
+            return true;
+        } else if (segment.a_ == segment.b_) {
+            return false;
+        }
+
+        BasicVector<T> direction = segment.b_ - segment.a_;
+        BasicVector<T> offset = v - segment.a_;
+        if (ScalarMultiplication(direction, offset) < 0 ||
+            ScalarMultiplication(direction, segment.b_ - v) < 0) {
+            return false;
+        }
+        RealType<T> cross = VectorMultiplication(direction, offset);
+        // Для целых координат полоса сужается до самой прямой, иначе проверяется
+        // |cross| / |direction| < eps без извлечения корня.
+        bool in_band = std::is_integral_v<T>
+                               ? cross == 0
+                               : cross * cross < kEpsOf<T> * kEpsOf<T> *
+                                                         ScalarMultiplication(direction, direction);
+        if (in_band) {
+            OLYMP_GEOMETRY_COUNT(kLiesOnEpsBand);
+        }
+        return in_band;
+    }
 
-    bool LiesOn(Segment &&segment, Vector &&v);
+    /*!
+    Проверяет, лежит ли точка в круге: на расстоянии от центра не больше радиуса плюс
+    kEpsOf<RealType<T>>. Сравниваются квадраты расстояний, без корня.
+    \param[in] circle Круг
+    \param[in] v Точка
+    \return true, если v внутри circle или на его границе
+    */
+    template <typename T>
+    constexpr bool Contains(const BasicCircle<T> &circle, const BasicVector<T> &v) {
+        BasicVector<RealType<T>> d(v - circle.center_);
+        RealType<T> limit = static_cast<RealType<T>>(circle.radius_) + kEpsOf<RealType<T>>;
+        return ScalarMultiplication(d, d) <= limit * limit;
+    }
     ///@}
 
     /*!
-    \defgroup intersection Пересечение
+    \defgroup other_relative_position Прочее
     \ingroup relative_position
-    \brief Модуль для нахождения пересечений объектов
+    \brief Содержит такие методы, как 'лежат ли точки по разные стороны от прямой'.
     */
     ///@{
-    bool Intersect(const Segment &s1, const Segment &s2);
-
-    bool Intersect(const Segment &s1, Segment &&s2);
+    /*!
+    Ориентация тройки точек, всегда вычисляется точно (см. \ref predicates).
+    \return 1, если a, b, c идут против часовой стрелки, -1 - если по часовой, 0 - если
+    точки лежат на одной прямой
+    */
+    template <typename T>
+    constexpr int Orient2D(const BasicVector<T> &a, const BasicVector<T> &b,
+                           const BasicVector<T> &c) {
+        return Orient2D(a.x_, a.y_, b.x_, b.y_, c.x_, c.y_);
+    }
 
-    bool Intersect(Segment &&s1, Segment &&s2);
+    /*!
+    Определяет, с какой стороны от прямой лежит точка, с той же точностью, что и OnSameSide.
+    \param[in] line Прямая
+    \param[in] v Точка
+    \return 1 или -1 по знаку A*x + B*y + C, 0 если точка лежит на прямой
+    */
+    template <typename T>
+    constexpr int SideOfLine(const BasicLine<T> &line, const BasicVector<T> &v) {
+        OLYMP_GEOMETRY_COUNT(kSideOfLine);
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+        if constexpr (std::is_floating_point_v<T>) {
+            return LinearFormSign(line.A_, v.x_, line.B_, v.y_, line.C_);
+        }
+#endif
+        T alpha = line.A_ * v.x_ + line.B_ * v.y_ + line.C_;
+        if (detail::Abs(alpha) < kEpsOf<T>) {
+            return 0;
+        } else {
+            return alpha > 0 ? 1 : -1;
+        }
+    }
+
+    template <typename T>
+    constexpr bool OnSameSideEq(const BasicLine<T> &line, const BasicVector<T> &a,
+                                const BasicVector<T> &b) {
+        OLYMP_GEOMETRY_COUNT(kOnSameSideEq);
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+        if constexpr (std::is_floating_point_v<T>) {
+            int side1 = SideOfLine(line, a), side2 = SideOfLine(line, b);
+            return side1 == 0 || side2 == 0 || side1 == side2;
+        }
+#endif
+        T alpha1 = line.A_ * a.x_ + line.B_ * a.y_ + line.C_;
+        T alpha2 = line.A_ * b.x_ + line.B_ * b.y_ + line.C_;
+
+        if (detail::Abs(alpha1) < kEpsOf<T> || detail::Abs(alpha2) < kEpsOf<T>) {
+            OLYMP_GEOMETRY_COUNT(kOnSameSideEqEpsBand);
+            return true;
+        } else {
+            if ((alpha1 < 0 && alpha2 < 0) || (alpha1 > 0 && alpha2 > 0)) {
+                return true;
+            } else {
+                return false;
+            }
+        }
+    }
+
+    template <typename T>
+    constexpr bool OnSameSide(const BasicLine<T> &line, const BasicVector<T> &a,
+                              const BasicVector<T> &b) {
+        OLYMP_GEOMETRY_COUNT(kOnSameSide);
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+        if constexpr (std::is_floating_point_v<T>) {
+            return SideOfLine(line, a) * SideOfLine(line, b) > 0;
+        }
+#endif
+        T alpha1 = line.A_ * a.x_ + line.B_ * a.y_ + line.C_;
+        T alpha2 = line.A_ * b.x_ + line.B_ * b.y_ + line.C_;
+
+        if (detail::Abs(alpha1) < kEpsOf<T> || detail::Abs(alpha2) < kEpsOf<T>) {
+            OLYMP_GEOMETRY_COUNT(kOnSameSideEpsBand);
+            return false;
+        } else {
+            if ((alpha1 < 0 && alpha2 < 0) || (alpha1 > 0 && alpha2 > 0)) {
+                return true;
+            } else {
+                return false;
+            }
+        }
+    }
     ///@}
 
     /*!
-    \defgroup other_relative_position Прочее
+    \defgroup intersection Пересечение
     \ingroup relative_position
-    \brief Содержит такие методы, как 'лежат ли точки по разные стороны от прямой'.
+    \brief Модуль для нахождения пересечений объектов
     */
     ///@{
-    bool OnSameSideEq(const Line &line, const Vector &a, const Vector &b);
-
-    bool OnSameSideEq(const Line &line, const Vector &a, Vector &&b);
-
-    bool OnSameSideEq(const Line &line, Vector &&a, Vector &&b);
-
-    bool OnSameSideEq(Line &&line, const Vector &a, const Vector &b);
+    namespace detail {
+        // Ветвь Intersect с точными предикатами в тех же категориях, что и без них. Концы
+        // сравниваются точно, одна прямая - это нулевые ориентации концов s2 относительно
+        // невырожденного s1.
+        template <typename T>
+        void CountExactIntersectBranch(const BasicSegment<T> &s1, const BasicSegment<T> &s2,
+                                       int o1, int o2, int o3, int o4) {
+            auto same = [](const BasicVector<T> &a, const BasicVector<T> &b) {
+                return a.x_ == b.x_ && a.y_ == b.y_;
+            };
+            if (same(s1.a_, s2.a_) || same(s1.a_, s2.b_) || same(s1.b_, s2.a_) ||
+                same(s1.b_, s2.b_)) {
+                OLYMP_GEOMETRY_COUNT(kIntersectSharedEndpoint);
+            } else if (same(s1.a_, s1.b_) || same(s2.a_, s2.b_)) {
+                OLYMP_GEOMETRY_COUNT(kIntersectDegenerate);
+            } else if (o1 == 0 && o2 == 0) {
+                OLYMP_GEOMETRY_COUNT(kIntersectCollinear);
+            } else if (o1 == 0 || o2 == 0 || o3 == 0 || o4 == 0) {
+                OLYMP_GEOMETRY_COUNT(kIntersectZeroOrientation);
+            } else {
+                OLYMP_GEOMETRY_COUNT(kIntersectGeneral);
+            }
+        }
+    }
+
+    template <typename T>
+    bool Intersect(const BasicSegment<T> &s1, const BasicSegment<T> &s2) {
+        OLYMP_GEOMETRY_TIME(kIntersectSegments);
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+        if constexpr (std::is_floating_point_v<T>) {
+            // Ориентации считаются по концам отрезков, а не по прямым с округлёнными
+            // коэффициентами.
+            int o1 = Orient2D(s1.a_, s1.b_, s2.a_), o2 = Orient2D(s1.a_, s1.b_, s2.b_);
+            int o3 = Orient2D(s2.a_, s2.b_, s1.a_), o4 = Orient2D(s2.a_, s2.b_, s1.b_);
+#ifdef OLYMP_GEOMETRY_INSTRUMENTATION
+            detail::CountExactIntersectBranch(s1, s2, o1, o2, o3, o4);
+#endif
+            if ((o1 == 0 && LiesOn(s1, s2.a_)) || (o2 == 0 && LiesOn(s1, s2.b_)) ||
+                (o3 == 0 && LiesOn(s2, s1.a_)) || (o4 == 0 && LiesOn(s2, s1.b_))) {
+                return true;
+            }
+            return o1 * o2 < 0 && o3 * o4 < 0;
+        }
+#endif
+        if (s1.a_ == s2.a_ || s1.a_ == s2.b_ || s1.b_ == s2.a_ || s1.b_ == s2.b_) {
+            OLYMP_GEOMETRY_COUNT(kIntersectSharedEndpoint);
+            return true;
+        } else if (s1.a_ == s1.b_) {
+            OLYMP_GEOMETRY_COUNT(kIntersectDegenerate);
+            return LiesOn(s2, s1.a_);
+        } else if (s2.a_ == s2.b_) {
+            OLYMP_GEOMETRY_COUNT(kIntersectDegenerate);
+            return LiesOn(s1, s2.a_);
+        }
+        BasicLine<T> line1(s1.a_, s1.b_);
+        BasicLine<T> line2(s2.a_, s2.b_);
+        if (line1 == line2) { // проверяем, что хотя бы одна точка s2 лежит на отрезке s1
+            // или s1 целиком лежит внутри s2
+            OLYMP_GEOMETRY_COUNT(kIntersectCollinear);
+            if (LiesOn(s1, s2.a_) || LiesOn(s1, s2.b_) || LiesOn(s2, s1.a_)) {
+                return true;
+            } else {
+                return false;
+            }
+        }
+        OLYMP_GEOMETRY_COUNT(kIntersectGeneral);
+        if (OnSameSide(line1, s2.a_, s2.b_) || OnSameSide(line2, s1.a_, s1.b_)) {
+            return false;
+        } else {
+            return true;
+        }
+    }
 
-    bool OnSameSideEq(Line &&line, const Vector &a, Vector &&b);
-
-    bool OnSameSideEq(Line &&line, Vector &&a, Vector &&b);
-
-    bool OnSameSide(const Line &line, const Vector &a, const Vector &b);
+    /*!
+    Что получилось в пересечении: ничего, одна точка, общий отрезок или, для окружностей,
+    две точки.
+    */
+    enum class IntersectionKind {
+        kNone,
+        kPoint,
+        kOverlap,
+        kTwoPoints
+    };
 
-    bool OnSameSide(const Line &line, const Vector &a, Vector &&b);
+    /*!
+    \brief Пересечение двух объектов. Координаты вещественные даже для целых T.
+    */
+    template <typename T>
+    struct IntersectionResult {
+        IntersectionKind kind_ = IntersectionKind::kNone;
+        //! Точка пересечения или первый конец общего отрезка
+        BasicVector<RealType<T>> a_;
+        //! Второй конец общего отрезка или вторая точка, для kPoint совпадает с a_
+        BasicVector<RealType<T>> b_;
+    };
 
-    bool OnSameSide(const Line &line, Vector &&a, Vector &&b);
+    namespace detail {
+        template <typename T>
+        IntersectionResult<T> PointResult(const BasicVector<RealType<T>> &point) {
+            return {IntersectionKind::kPoint, point, point};
+        }
+
+        // Общий отрезок [a, b]; если его концы совпадают, то это точка.
+        template <typename T>
+        IntersectionResult<T> OverlapResult(const BasicVector<RealType<T>> &a,
+                                            const BasicVector<RealType<T>> &b) {
+            if (a == b) {
+                return PointResult<T>(a);
+            }
+            return {IntersectionKind::kOverlap, a, b};
+        }
+
+        template <typename T>
+        IntersectionResult<T> TwoPointResult(const BasicVector<RealType<T>> &a,
+                                             const BasicVector<RealType<T>> &b) {
+            return {IntersectionKind::kTwoPoints, a, b};
+        }
+    }
 
-    bool OnSameSide(Line &&line, const Vector &a, const Vector &b);
+    /*!
+    \param[in] l1 Первая прямая
+    \param[in] l2 Вторая прямая
+    \return Точка пересечения или std::nullopt для параллельных и совпадающих прямых
+    */
+    template <typename T>
+    std::optional<BasicVector<RealType<T>>> IntersectionPoint(const BasicLine<T> &l1,
+                                                              const BasicLine<T> &l2) {
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+        if constexpr (std::is_floating_point_v<T>) {
+            if (DeterminantSign(l1.A_, l1.B_, l2.A_, l2.B_) == 0) {
+                return std::nullopt;
+            }
+        }
+#endif
+        RealType<T> determinant = static_cast<RealType<T>>(l1.A_) * l2.B_ -
+                                  static_cast<RealType<T>>(l2.A_) * l1.B_;
+        if (determinant == 0 || detail::Abs(determinant) < kEpsOf<T>) {
+            return std::nullopt;
+        }
+        RealType<T> x = static_cast<RealType<T>>(l1.B_) * l2.C_ -
+                        static_cast<RealType<T>>(l2.B_) * l1.C_;
+        RealType<T> y = static_cast<RealType<T>>(l2.A_) * l1.C_ -
+                        static_cast<RealType<T>>(l1.A_) * l2.C_;
+        return BasicVector<RealType<T>>(x / determinant, y / determinant);
+    }
 
-    bool OnSameSide(Line &&line, const Vector &a, Vector &&b);
+    /*!
+    Пересечение прямой и отрезка. Стороны концов отрезка определяются через SideOfLine.
+    \param[in] line Прямая
+    \param[in] segment Отрезок
+    \return Точка, или весь отрезок, если он лежит на прямой
+    */
+    template <typename T>
+    IntersectionResult<T> Intersection(const BasicLine<T> &line, const BasicSegment<T> &segment) {
+        using Point = BasicVector<RealType<T>>;
+        int side_a = SideOfLine(line, segment.a_), side_b = SideOfLine(line, segment.b_);
+        if (side_a == 0 && side_b == 0) {
+            return detail::OverlapResult<T>(Point(segment.a_), Point(segment.b_));
+        } else if (side_a == 0) {
+            return detail::PointResult<T>(Point(segment.a_));
+        } else if (side_b == 0) {
+            return detail::PointResult<T>(Point(segment.b_));
+        } else if (side_a == side_b) {
+            return {};
+        }
+        RealType<T> value_a = static_cast<RealType<T>>(line.A_ * segment.a_.x_ +
+                                                       line.B_ * segment.a_.y_ + line.C_);
+        RealType<T> value_b = static_cast<RealType<T>>(line.A_ * segment.b_.x_ +
+                                                       line.B_ * segment.b_.y_ + line.C_);
+        RealType<T> t = std::clamp<RealType<T>>(value_a / (value_a - value_b), 0, 1);
+        Point a(segment.a_), d(segment.b_ - segment.a_);
+        return detail::PointResult<T>(Point(a.x_ + d.x_ * t, a.y_ + d.y_ * t));
+    }
 
-    bool OnSameSide(Line &&line, Vector &&a, Vector &&b);
+    /*!
+    Пересечение луча и отрезка: пересечение прямой луча с отрезком, обрезанное по началу
+    луча.
+    \param[in] beam Луч
+    \param[in] segment Отрезок
+    \return Точка или общий отрезок, концы которого упорядочены как в segment
+    */
+    template <typename T>
+    IntersectionResult<T> Intersection(const BasicBeam<T> &beam, const BasicSegment<T> &segment) {
+        using Point = BasicVector<RealType<T>>;
+        Point start(beam.a_), direction(beam.b_ - beam.a_);
+        if (beam.a_ == beam.b_) {
+            return LiesOn(segment, beam.a_) ? detail::PointResult<T>(start)
+                                            : IntersectionResult<T>();
+        }
+        IntersectionResult<T> result = Intersection(BasicLine<T>(beam.a_, beam.b_), segment);
+        // Точки с отрицательной проекцией на направление луча лежат за его началом.
+        auto behind = [&](const Point &p) {
+            return ScalarMultiplication(p - start, direction) < 0 && !(p == start);
+        };
+        bool behind_a = behind(result.a_), behind_b = behind(result.b_);
+        if (result.kind_ == IntersectionKind::kNone || (behind_a && behind_b)) {
+            return {};
+        } else if (behind_a) {
+            return detail::OverlapResult<T>(start, result.b_);
+        } else if (behind_b) {
+            return detail::OverlapResult<T>(result.a_, start);
+        }
+        return result;
+    }
 
+    /*!
+    Пересечение двух отрезков. Результат не kNone ровно тогда, когда Intersect(s1, s2).
+    \param[in] s1 Первый отрезок
+    \param[in] s2 Второй отрезок
+    \return Точка, или общий отрезок для отрезков на одной прямой, концы которого
+    упорядочены по направлению s1
+    */
+    template <typename T>
+    IntersectionResult<T> Intersection(const BasicSegment<T> &s1, const BasicSegment<T> &s2) {
+        OLYMP_GEOMETRY_TIME(kIntersectionSegments);
+        using Point = BasicVector<RealType<T>>;
+        if (!Intersect(s1, s2)) {
+            return {};
+        }
+        Point a1(s1.a_), a2(s2.a_), b2(s2.b_), d1(s1.b_ - s1.a_), d2(s2.b_ - s2.a_);
+        if (s1.a_ == s1.b_) {
+            return detail::PointResult<T>(a1);
+        } else if (s2.a_ == s2.b_) {
+            return detail::PointResult<T>(a2);
+        }
+        if (BasicLine<T>(s1.a_, s1.b_) == BasicLine<T>(s2.a_, s2.b_)) {
+            // Параметры концов s2 вдоль s1: сам s1 - это [0, |d1|^2].
+            RealType<T> t_a = ScalarMultiplication(a2 - a1, d1);
+            RealType<T> t_b = ScalarMultiplication(b2 - a1, d1);
+            if (t_b < t_a) {
+                std::swap(t_a, t_b);
+                std::swap(a2, b2);
+            }
+            Point from = t_a > 0 ? a2 : a1;
+            Point to = t_b < ScalarMultiplication(d1, d1) ? b2 : Point(s1.b_);
+            return detail::OverlapResult<T>(from, to);
+        }
+        if (s1.a_ == s2.a_ || s1.a_ == s2.b_) {
+            return detail::PointResult<T>(a1);
+        } else if (s1.b_ == s2.a_ || s1.b_ == s2.b_) {
+            return detail::PointResult<T>(Point(s1.b_));
+        }
+        RealType<T> denominator = VectorMultiplication(d1, d2);
+        if (denominator == 0) {
+            return detail::PointResult<T>(a1);
+        }
+        RealType<T> t =
+                std::clamp<RealType<T>>(VectorMultiplication(a2 - a1, d2) / denominator, 0, 1);
+        return detail::PointResult<T>(Point(a1.x_ + d1.x_ * t, a1.y_ + d1.y_ * t));
+    }
     ///@}
     ///@}
 
@@ -297,41 +879,402 @@ namespace olymp_geometry {
     \brief Предоставляет различные функции для работы с расстояниями.
     */
     ///@{
+    template <typename T>
+    RealType<T> Dist(const BasicVector<T> &a, const BasicVector<T> &b) {
+        return (b - a).Length();
+    }
+
+    template <typename T>
+    RealType<T> Dist(const BasicLine<T> &line, const BasicVector<T> &v) {
+        OLYMP_GEOMETRY_TIME(kDistLine);
+        return std::abs(static_cast<RealType<T>>(line.A_ * v.x_ + line.B_ * v.y_ + line.C_)) /
+               line.GetNormal().Length();
+    }
+
+    namespace detail {
+        // Проекция v попадает строго внутрь луча. Для вырожденного луча это всегда false.
+        template <typename T>
+        constexpr bool ProjectsInside(const BasicBeam<T> &beam, const BasicVector<T> &v) {
+            return ScalarMultiplication(beam.b_ - beam.a_, v - beam.a_) > 0;
+        }
+
+        template <typename T>
+        constexpr bool ProjectsInside(const BasicSegment<T> &segment, const BasicVector<T> &v) {
+            BasicVector<T> direction = segment.b_ - segment.a_;
+            return ScalarMultiplication(direction, v - segment.a_) > 0 &&
+                   ScalarMultiplication(direction, segment.b_ - v) > 0;
+        }
+    }
+
+    template <typename T>
+    RealType<T> Dist(const BasicBeam<T> &beam, const BasicVector<T> &v) {
+        if (detail::ProjectsInside(beam, v)) {
+            return Dist(BasicLine<T>(beam.a_, beam.b_), v);
+        } else {
+            return Dist(beam.a_, v);
+        }
+    }
+
+    template <typename T>
+    RealType<T> Dist(const BasicSegment<T> &segment, const BasicVector<T> &v) {
+        OLYMP_GEOMETRY_TIME(kDistSegment);
+        if (detail::ProjectsInside(segment, v)) {
+            return Dist(BasicLine<T>(segment.a_, segment.b_), v);
+        } else {
+            return std::min(Dist(segment.a_, v), Dist(segment.b_, v));
+        }
+    }
+
+    /*!
+    \defgroup distances_squared Квадраты расстояний
+    \ingroup distances
+    \brief То же, что Dist, но без извлечения корня: подходит для сравнения расстояний
+    между собой и с заданным порогом.
+    */
+    ///@{
+    template <typename T>
+    constexpr RealType<T> DistSquared(const BasicVector<T> &a, const BasicVector<T> &b) {
+        BasicVector<RealType<T>> d(b - a);
+        return ScalarMultiplication(d, d);
+    }
+
+    template <typename T>
+    constexpr RealType<T> DistSquared(const BasicLine<T> &line, const BasicVector<T> &v) {
+        OLYMP_GEOMETRY_COUNT(kDistSquaredLine);
+        RealType<T> value = static_cast<RealType<T>>(line.A_ * v.x_ + line.B_ * v.y_ + line.C_);
+        BasicVector<RealType<T>> normal(line.GetNormal());
+        return value * value / ScalarMultiplication(normal, normal);
+    }
+
+    template <typename T>
+    constexpr RealType<T> DistSquared(const BasicBeam<T> &beam, const BasicVector<T> &v) {
+        if (detail::ProjectsInside(beam, v)) {
+            return DistSquared(BasicLine<T>(beam.a_, beam.b_), v);
+        } else {
+            return DistSquared(beam.a_, v);
+        }
+    }
+
+    template <typename T>
+    constexpr RealType<T> DistSquared(const BasicSegment<T> &segment,
+                                      const BasicVector<T> &v) {
+        OLYMP_GEOMETRY_COUNT(kDistSquaredSegment);
+        if (detail::ProjectsInside(segment, v)) {
+            return DistSquared(BasicLine<T>(segment.a_, segment.b_), v);
+        } else {
+            return std::min(DistSquared(segment.a_, v), DistSquared(segment.b_, v));
+        }
+    }
+    ///@}
+    ///@}
 
-    long double Dist(const Vector &a, const Vector &b);
+    /*!
+    \defgroup normalized_line Нормированная прямая
+    \ingroup distances
+    \brief Функции BasicNormalizedLine: одно умножение-сложение на точку вместо корня и
+    деления в Dist(Line, Vector).
+    */
+    ///@{
 
-    long double Dist(const Vector &a, Vector &b);
+    /*!
+    \param[in] line Прямая
+    \param[in] v Точка
+    \return Расстояние от v до прямой со знаком: положительное со стороны нормали (A, B)
+    */
+    template <typename T>
+    constexpr RealType<T> SignedDist(const BasicNormalizedLine<T> &line, const BasicVector<T> &v) {
+        return line.A_ * v.x_ + line.B_ * v.y_ + line.C_;
+    }
+
+    template <typename T>
+    constexpr RealType<T> Dist(const BasicNormalizedLine<T> &line, const BasicVector<T> &v) {
+        return detail::Abs(SignedDist(line, v));
+    }
+
+    template <typename T>
+    constexpr RealType<T> DistSquared(const BasicNormalizedLine<T> &line,
+                                      const BasicVector<T> &v) {
+        RealType<T> d = SignedDist(line, v);
+        return d * d;
+    }
 
-    long double Dist(Vector &&a, Vector &&b);
+    /*!
+    В отличие от SideOfLine для BasicLine, точность kEpsOf сравнивается с настоящим
+    расстоянием, а не с A*x + B*y + C ненормированной прямой. Расстояние вещественное и для
+    целых координат, поэтому точность берётся для RealType<T>.
+    \param[in] line Прямая
+    \param[in] v Точка
+    \return 1 со стороны нормали, -1 с другой стороны, 0 если точка лежит на прямой
+    */
+    template <typename T>
+    constexpr int SideOfLine(const BasicNormalizedLine<T> &line, const BasicVector<T> &v) {
+        RealType<T> d = SignedDist(line, v);
+        return d >= kEpsOf<RealType<T>> ? 1 : (d <= -kEpsOf<RealType<T>> ? -1 : 0);
+    }
 
-    long double Dist(const Line &line, const Vector &v);
+    /*!
+    \param[in] line Прямая
+    \param[in] v Точка
+    \return Проекция v на прямую
+    */
+    template <typename T>
+    constexpr BasicVector<RealType<T>> Project(const BasicNormalizedLine<T> &line,
+                                               const BasicVector<T> &v) {
+        RealType<T> d = SignedDist(line, v);
+        return BasicVector<RealType<T>>(v.x_ - line.A_ * d, v.y_ - line.B_ * d);
+    }
+    ///@}
 
-    long double Dist(Line &&line, const Vector &v);
+    /*!
+    \defgroup circle Круги
+    \ingroup relative_position
+    \brief Пересечения и расстояния для кругов. В Intersect и Dist круг берётся вместе с
+    внутренностью и радиусом, увеличенным на kEpsOf<RealType<T>>, а Intersection ищет точки его
+    границы - окружности. Intersect сравнивает квадраты расстояний и обходится без корня.
+    */
+    ///@{
 
-    long double Dist(const Line &line, Vector &&v);
+    namespace detail {
+        // Квадрат радиуса с допуском: точки не дальше от центра считаются в круге.
+        template <typename T>
+        constexpr RealType<T> HitRadiusSquared(const BasicCircle<T> &circle) {
+            RealType<T> r = static_cast<RealType<T>>(circle.radius_) + kEpsOf<RealType<T>>;
+            return r * r;
+        }
+
+        // Задевает ли отрезок (ax, ay) - (bx, by) круг с центром (cx, cy) и квадратом радиуса
+        // limit: ближе limit один из концов или проекция центра внутри отрезка и
+        // cross^2 / |b - a|^2 <= limit. Пакетные ядра повторяют эти операции по порядку.
+        template <typename T>
+        constexpr bool SegmentHitsDisk(T cx, T cy, T limit, T ax, T ay, T bx, T by) {
+            T dx = bx - ax, dy = by - ay, fx = cx - ax, fy = cy - ay, gx = cx - bx, gy = cy - by;
+            T t = fx * dx + fy * dy, length = dx * dx + dy * dy, cross = dx * fy - dy * fx;
+            return fx * fx + fy * fy <= limit || gx * gx + gy * gy <= limit ||
+                   (t > 0 && t < length && cross * cross <= limit * length);
+        }
+
+        // Квадрат расстояния от (cx, cy) до отрезка теми же операциями.
+        template <typename T>
+        constexpr T SegmentDistSquared(T cx, T cy, T ax, T ay, T bx, T by) {
+            T dx = bx - ax, dy = by - ay, fx = cx - ax, fy = cy - ay, gx = cx - bx, gy = cy - by;
+            T t = fx * dx + fy * dy, length = dx * dx + dy * dy, cross = dx * fy - dy * fx;
+            if (t <= 0) {
+                return fx * fx + fy * fy;
+            } else if (t >= length) {
+                return gx * gx + gy * gy;
+            }
+            return cross * cross / length;
+        }
+
+        // Точки окружности на прямой через point с направлением direction, по направлению.
+        template <typename T>
+        IntersectionResult<T> CircleLineResult(const BasicCircle<T> &circle,
+                                               const BasicVector<RealType<T>> &point,
+                                               const BasicVector<RealType<T>> &direction) {
+            using Point = BasicVector<RealType<T>>;
+            Point center(circle.center_), offset = center - point;
+            RealType<T> length = ScalarMultiplication(direction, direction);
+            RealType<T> along = ScalarMultiplication(offset, direction) / length;
+            Point foot(point.x_ + direction.x_ * along, point.y_ + direction.y_ * along);
+            RealType<T> radius = circle.radius_, distance = Dist(center, foot);
+            if (distance > radius + kEpsOf<RealType<T>>) {
+                return IntersectionResult<T>();
+            } else if (distance > radius - kEpsOf<RealType<T>>) {
+                return PointResult<T>(foot);
+            }
+            RealType<T> half = std::sqrt((radius - distance) * (radius + distance) / length);
+            Point shift(direction.x_ * half, direction.y_ * half);
+            return TwoPointResult<T>(foot - shift, foot + shift);
+        }
+
+        // Оставляет из точек result те, что на луче или отрезке from -> to.
+        template <typename T>
+        IntersectionResult<T> KeepOnSegment(const IntersectionResult<T> &result,
+                                            const BasicVector<T> &from, const BasicVector<T> &to,
+                                            bool beam) {
+            using Point = BasicVector<RealType<T>>;
+            Point a(from), b(to), direction = b - a;
+            RealType<T> tolerance = kEpsOf<RealType<T>> * direction.Length();
+            auto inside = [&](const Point &p) {
+                return ScalarMultiplication(p - a, direction) >= -tolerance &&
+                       (beam || ScalarMultiplication(b - p, direction) >= -tolerance);
+            };
+            bool first = result.kind_ != IntersectionKind::kNone && inside(result.a_);
+            bool second = result.kind_ == IntersectionKind::kTwoPoints && inside(result.b_);
+            if (first && second) {
+                return result;
+            } else if (first || second) {
+                return PointResult<T>(first ? result.a_ : result.b_);
+            }
+            return IntersectionResult<T>();
+        }
+    }
 
-    long double Dist(Line &&line, Vector &&v);
+    /*!
+    \param[in] circle Круг
+    \param[in] line Прямая
+    \return true, если прямая проходит через круг: (A*x + B*y + C)^2 <= r^2 * (A^2 + B^2)
+    */
+    template <typename T>
+    constexpr bool Intersect(const BasicCircle<T> &circle, const BasicLine<T> &line) {
+        RealType<T> value = line.A_ * circle.center_.x_ + line.B_ * circle.center_.y_ + line.C_;
+        RealType<T> norm = line.A_ * line.A_ + line.B_ * line.B_;
+        return value * value <= detail::HitRadiusSquared(circle) * norm;
+    }
+
+    template <typename T>
+    constexpr bool Intersect(const BasicCircle<T> &circle, const BasicSegment<T> &segment) {
+        using Real = RealType<T>;
+        return detail::SegmentHitsDisk<Real>(circle.center_.x_, circle.center_.y_,
+                                             detail::HitRadiusSquared(circle), segment.a_.x_,
+                                             segment.a_.y_, segment.b_.x_, segment.b_.y_);
+    }
+
+    template <typename T>
+    constexpr bool Intersect(const BasicCircle<T> &circle, const BasicBeam<T> &beam) {
+        BasicVector<RealType<T>> center(circle.center_), a(beam.a_), b(beam.b_);
+        BasicVector<RealType<T>> direction = b - a, offset = center - a;
+        RealType<T> limit = detail::HitRadiusSquared(circle);
+        RealType<T> cross = VectorMultiplication(direction, offset);
+        return ScalarMultiplication(offset, offset) <= limit ||
+               (ScalarMultiplication(offset, direction) > 0 &&
+                cross * cross <= limit * ScalarMultiplication(direction, direction));
+    }
+
+    template <typename T>
+    constexpr bool Intersect(const BasicCircle<T> &a, const BasicCircle<T> &b) {
+        RealType<T> r = static_cast<RealType<T>>(a.radius_) + b.radius_ + kEpsOf<RealType<T>>;
+        return DistSquared(a.center_, b.center_) <= r * r;
+    }
 
-    long double Dist(const Beam &beam, const Vector &v);
+    /*!
+    \param[in] circle Круг
+    \param[in] line Прямая
+    \return Расстояние от круга до прямой, 0 если они пересекаются
+    */
+    template <typename T>
+    RealType<T> Dist(const BasicCircle<T> &circle, const BasicLine<T> &line) {
+        return std::max<RealType<T>>(0, Dist(line, circle.center_) - circle.radius_);
+    }
+
+    template <typename T>
+    RealType<T> Dist(const BasicCircle<T> &circle, const BasicSegment<T> &segment) {
+        using Real = RealType<T>;
+        Real squared = detail::SegmentDistSquared<Real>(circle.center_.x_, circle.center_.y_,
+                                                        segment.a_.x_, segment.a_.y_,
+                                                        segment.b_.x_, segment.b_.y_);
+        return std::max<Real>(0, std::sqrt(squared) - circle.radius_);
+    }
+
+    template <typename T>
+    RealType<T> Dist(const BasicCircle<T> &circle, const BasicBeam<T> &beam) {
+        return std::max<RealType<T>>(0, Dist(beam, circle.center_) - circle.radius_);
+    }
+
+    template <typename T>
+    RealType<T> Dist(const BasicCircle<T> &a, const BasicCircle<T> &b) {
+        return std::max<RealType<T>>(0, Dist(a.center_, b.center_) - a.radius_ - b.radius_);
+    }
 
-    long double Dist(const Beam &beam, Vector &&v);
+    /*!
+    Точки окружности на прямой.
+    \param[in] circle Круг
+    \param[in] line Прямая, (A, B) != (0, 0)
+    \return Ничего, точка касания или две точки по направлению прямой (-B, A), как у
+    BasicLine(a, b) от a к b
+    */
+    template <typename T>
+    IntersectionResult<T> Intersection(const BasicCircle<T> &circle, const BasicLine<T> &line) {
+        using Point = BasicVector<RealType<T>>;
+        RealType<T> a = line.A_, b = line.B_, c = line.C_;
+        // Точка прямой, ближайшая к началу координат.
+        Point point(-a * c / (a * a + b * b), -b * c / (a * a + b * b));
+        return detail::CircleLineResult(circle, point, Point(-b, a));
+    }
 
-    long double Dist(Beam &&beam, const Vector &v);
+    /*!
+    \return Точки окружности на отрезке, по порядку от a_ к b_
+    */
+    template <typename T>
+    IntersectionResult<T> Intersection(const BasicCircle<T> &circle,
+                                       const BasicSegment<T> &segment) {
+        using Point = BasicVector<RealType<T>>;
+        if (segment.a_ == segment.b_) {
+            Point a(segment.a_);
+            RealType<T> distance = Dist(Point(circle.center_), a);
+            return detail::Abs(distance - circle.radius_) < kEpsOf<RealType<T>>
+                           ? detail::PointResult<T>(a)
+                           : IntersectionResult<T>();
+        }
+        Point a(segment.a_), b(segment.b_);
+        return detail::KeepOnSegment(detail::CircleLineResult(circle, a, b - a), segment.a_,
+                                     segment.b_, false);
+    }
 
-    long double Dist(Beam &&beam, Vector &&v);
+    /*!
+    \return Точки окружности на луче, по порядку от начала луча
+    */
+    template <typename T>
+    IntersectionResult<T> Intersection(const BasicCircle<T> &circle, const BasicBeam<T> &beam) {
+        using Point = BasicVector<RealType<T>>;
+        Point a(beam.a_), b(beam.b_);
+        return detail::KeepOnSegment(detail::CircleLineResult(circle, a, b - a), beam.a_,
+                                     beam.b_, true);
+    }
 
-    long double Dist(const Segment &segment, const Vector &v);
+    /*!
+    Точки пересечения двух окружностей.
+    \param[in] first Первая окружность
+    \param[in] second Вторая окружность
+    \return Ничего, точка касания или две точки: a_ справа, b_ слева от направления от
+    центра first к центру second. Для совпадающих окружностей - kOverlap с a_ = b_, равными
+    самой правой точке окружности
+    */
+    template <typename T>
+    IntersectionResult<T> Intersection(const BasicCircle<T> &first, const BasicCircle<T> &second) {
+        using Point = BasicVector<RealType<T>>;
+        Point c1(first.center_), c2(second.center_), axis = c2 - c1;
+        RealType<T> r1 = first.radius_, r2 = second.radius_, d = axis.Length();
+        const RealType<T> eps = kEpsOf<RealType<T>>;
+        if (d < eps) {
+            if (detail::Abs(r1 - r2) < eps) {
+                Point rightmost(c1.x_ + r1, c1.y_);
+                return {IntersectionKind::kOverlap, rightmost, rightmost};
+            }
+            return IntersectionResult<T>();
+        }
+        if (d > r1 + r2 + eps || d < detail::Abs(r1 - r2) - eps) {
+            return IntersectionResult<T>();
+        }
+        // Расстояние от c1 до общей хорды вдоль оси и половина хорды.
+        RealType<T> along = (d * d + (r1 - r2) * (r1 + r2)) / (2 * d);
+        Point base(c1.x_ + axis.x_ * along / d, c1.y_ + axis.y_ * along / d);
+        if (d > r1 + r2 - eps || d < detail::Abs(r1 - r2) + eps) {
+            return detail::PointResult<T>(base);
+        }
+        RealType<T> half = std::sqrt(std::max<RealType<T>>(0, r1 * r1 - along * along)) / d;
+        Point shift(-axis.y_ * half, axis.x_ * half);
+        return detail::TwoPointResult<T>(base - shift, base + shift);
+    }
+    ///@}
 
-    long double Dist(const Segment &segment, Vector &&v);
+    /*!
+    \defgroup aliases Синонимы
+    \brief Классы над long double, исторический интерфейс библиотеки.
+    */
+    ///@{
+    using Vector = BasicVector<long double>;
 
-    long double Dist(Segment &&segment, const Vector &v);
+    using Line = BasicLine<long double>;
 
-    long double Dist(Segment &&segment, Vector &&v);
+    using NormalizedLine = BasicNormalizedLine<long double>;
 
-    ///@}
+    using Beam = BasicBeam<long double>;
 
+    using Segment = BasicSegment<long double>;
 
+    using Circle = BasicCircle<long double>;
+    ///@}
 }
 
-
-#endif //OLYMP_GEOMETRY_OLYMP_GEOMETRY_H
\ No newline at end of file
+#endif //OLYMP_GEOMETRY_OLYMP_GEOMETRY_H
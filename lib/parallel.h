@@ -0,0 +1,130 @@
+#ifndef OLYMP_GEOMETRY_PARALLEL_H
+#define OLYMP_GEOMETRY_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace olymp_geometry {
+    /*!
+    \defgroup parallel Многопоточность
+    \brief Число потоков для параллельных построений и пакетных запросов.
+    */
+    ///@{
+
+    namespace detail {
+        inline std::atomic<unsigned> &ActiveThreadCount() {
+            static std::atomic<unsigned> count(std::max(1u, std::thread::hardware_concurrency()));
+            return count;
+        }
+    }
+
+    /*!
+    \return Сколько потоков используют параллельные функции библиотеки
+    */
+    inline unsigned GetThreadCount() {
+        return detail::ActiveThreadCount().load(std::memory_order_relaxed);
+    }
+
+    /*!
+    Ограничивает число потоков параллельных функций. 1 отключает многопоточность, 0
+    возвращает значение по умолчанию - число аппаратных потоков.
+    \param[in] count Число потоков
+    */
+    inline void SetThreadCount(unsigned count) {
+        if (count == 0) {
+            count = std::max(1u, std::thread::hardware_concurrency());
+        }
+        detail::ActiveThreadCount().store(count, std::memory_order_relaxed);
+    }
+    ///@}
+
+    namespace detail {
+        // Делит [begin, end) на куски не меньше grain и вызывает function(from, to) для
+        // каждого в своём потоке. Последний кусок выполняется в вызывающем потоке.
+        template <typename Function>
+        void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                         const Function &function) {
+            if (begin >= end) {
+                return;
+            }
+            std::size_t n = end - begin;
+            grain = std::max<std::size_t>(grain, 1);
+            std::size_t chunks = std::min<std::size_t>(GetThreadCount(), (n + grain - 1) / grain);
+            if (chunks <= 1) {
+                function(begin, end);
+                return;
+            }
+            std::vector<std::thread> threads;
+            threads.reserve(chunks - 1);
+            for (std::size_t k = 0; k + 1 < chunks; ++k) {
+                threads.emplace_back(function, begin + n * k / chunks,
+                                     begin + n * (k + 1) / chunks);
+            }
+            function(begin + n * (chunks - 1) / chunks, end);
+            for (std::thread &thread : threads) {
+                thread.join();
+            }
+        }
+
+        // Разбивает [0, n) на chunks частей и вызывает function(k, from, to) для каждой в
+        // своём потоке. Номер части k позволяет собирать результаты без синхронизации.
+        template <typename Function>
+        void ForEachChunk(std::size_t n, std::size_t chunks, const Function &function) {
+            ParallelFor(0, chunks, 1, [&](std::size_t from, std::size_t to) {
+                for (std::size_t k = from; k < to; ++k) {
+                    function(k, n * k / chunks, n * (k + 1) / chunks);
+                }
+            });
+        }
+
+        // Выполняет first в отдельном потоке, а second - в текущем, если parallel, иначе
+        // оба по очереди.
+        template <typename First, typename Second>
+        void ParallelInvoke(bool parallel, const First &first, const Second &second) {
+            if (!parallel) {
+                first();
+                second();
+                return;
+            }
+            std::thread thread(first);
+            second();
+            thread.join();
+        }
+
+        // Глубина рекурсии, до которой стоит порождать потоки при делении задачи пополам.
+        inline int ParallelDepth() {
+            int depth = 0;
+            while ((1u << depth) < GetThreadCount()) {
+                ++depth;
+            }
+            return depth;
+        }
+
+        // Сортировка слиянием половин, отсортированных в разных потоках до глубины spawn.
+        // Куски меньше grain сортируются std::sort.
+        template <typename Iterator, typename Less>
+        void ParallelSort(Iterator begin, Iterator end, const Less &less, std::size_t grain,
+                          int spawn) {
+            std::size_t n = static_cast<std::size_t>(end - begin);
+            if (spawn <= 0 || n < 2 * grain) {
+                std::sort(begin, end, less);
+                return;
+            }
+            Iterator middle = begin + n / 2;
+            ParallelInvoke(
+                    true, [&] { ParallelSort(begin, middle, less, grain, spawn - 1); },
+                    [&] { ParallelSort(middle, end, less, grain, spawn - 1); });
+            std::inplace_merge(begin, middle, end, less);
+        }
+
+        template <typename Iterator, typename Less>
+        void ParallelSort(Iterator begin, Iterator end, const Less &less) {
+            ParallelSort(begin, end, less, 1 << 14, ParallelDepth());
+        }
+    }
+}
+
+#endif //OLYMP_GEOMETRY_PARALLEL_H
@@ -0,0 +1,611 @@
+#ifndef OLYMP_GEOMETRY_POINT_CLOUD_H
+#define OLYMP_GEOMETRY_POINT_CLOUD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "simd.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Набор точек в виде структуры массивов: координаты x и y хранятся в двух
+    отдельных выровненных массивах, что позволяет пакетным функциям обрабатывать
+    сразу несколько точек одной SIMD-инструкцией.
+    \tparam T Тип координат. Векторные ядра есть для double, для остальных типов
+    пакетные функции работают обычным циклом.
+    */
+    template <typename T>
+    class BasicPointCloud {
+    public:
+        BasicPointCloud() = default;
+
+        explicit BasicPointCloud(std::size_t size) : x_(size), y_(size) {
+        }
+
+        explicit BasicPointCloud(const std::vector<BasicVector<T>> &points) {
+            Reserve(points.size());
+            for (const BasicVector<T> &v : points) {
+                PushBack(v);
+            }
+        }
+
+        std::size_t Size() const {
+            return x_.size();
+        }
+
+        bool Empty() const {
+            return x_.empty();
+        }
+
+        void Reserve(std::size_t size) {
+            x_.reserve(size);
+            y_.reserve(size);
+        }
+
+        void Resize(std::size_t size) {
+            x_.resize(size);
+            y_.resize(size);
+        }
+
+        void Clear() {
+            x_.clear();
+            y_.clear();
+        }
+
+        void PushBack(const BasicVector<T> &v) {
+            x_.push_back(v.x_);
+            y_.push_back(v.y_);
+        }
+
+        void Set(std::size_t i, const BasicVector<T> &v) {
+            x_[i] = v.x_;
+            y_[i] = v.y_;
+        }
+
+        BasicVector<T> operator[](std::size_t i) const {
+            return {x_[i], y_[i]};
+        }
+
+        T *X() {
+            return x_.data();
+        }
+
+        const T *X() const {
+            return x_.data();
+        }
+
+        T *Y() {
+            return y_.data();
+        }
+
+        const T *Y() const {
+            return y_.data();
+        }
+
+    private:
+        std::vector<T, detail::AlignedAllocator<T>> x_, y_;
+    };
+
+    /*!
+    Основной тип для пакетной обработки. В отличие от Vector он хранит double, так как
+    для 80-битного long double векторных инструкций нет.
+    */
+    using PointCloud = BasicPointCloud<double>;
+
+    namespace detail {
+#if OLYMP_GEOMETRY_X86_SIMD
+        // |a*x + b*y + c| * inv
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline void DistLineSse2(const double *x, const double *y, std::size_t n, double a,
+                                 double b, double c, double inv, double *out) {
+            const __m128d va = _mm_set1_pd(a), vb = _mm_set1_pd(b), vc = _mm_set1_pd(c);
+            const __m128d vinv = _mm_set1_pd(inv), sign = _mm_set1_pd(-0.0);
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                __m128d v = _mm_add_pd(_mm_add_pd(_mm_mul_pd(va, _mm_loadu_pd(x + i)),
+                                                  _mm_mul_pd(vb, _mm_loadu_pd(y + i))),
+                                       vc);
+                _mm_storeu_pd(out + i, _mm_mul_pd(_mm_andnot_pd(sign, v), vinv));
+            }
+            for (; i < n; ++i) {
+                out[i] = std::abs(a * x[i] + b * y[i] + c) * inv;
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2
+        inline void DistLineAvx2(const double *x, const double *y, std::size_t n, double a,
+                                 double b, double c, double inv, double *out) {
+            const __m256d va = _mm256_set1_pd(a), vb = _mm256_set1_pd(b), vc = _mm256_set1_pd(c);
+            const __m256d vinv = _mm256_set1_pd(inv), sign = _mm256_set1_pd(-0.0);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256d v = _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i),
+                                            _mm256_fmadd_pd(vb, _mm256_loadu_pd(y + i), vc));
+                _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_andnot_pd(sign, v), vinv));
+            }
+            for (; i < n; ++i) {
+                out[i] = std::abs(a * x[i] + b * y[i] + c) * inv;
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512
+        inline void DistLineAvx512(const double *x, const double *y, std::size_t n, double a,
+                                   double b, double c, double inv, double *out) {
+            const __m512d va = _mm512_set1_pd(a), vb = _mm512_set1_pd(b), vc = _mm512_set1_pd(c);
+            const __m512d vinv = _mm512_set1_pd(inv);
+            for (std::size_t i = 0; i < n; i += 8) {
+                __mmask8 m = n - i >= 8 ? 0xFF : static_cast<__mmask8>((1u << (n - i)) - 1);
+                __m512d v = _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(m, x + i),
+                                            _mm512_fmadd_pd(vb, _mm512_maskz_loadu_pd(m, y + i),
+                                                            vc));
+                _mm512_mask_storeu_pd(out + i, m, _mm512_mul_pd(_mm512_abs_pd(v), vinv));
+            }
+        }
+
+        // sqrt((x - px)^2 + (y - py)^2)
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline void DistPointSse2(const double *x, const double *y, std::size_t n, double px,
+                                  double py, double *out) {
+            const __m128d vpx = _mm_set1_pd(px), vpy = _mm_set1_pd(py);
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                __m128d dx = _mm_sub_pd(_mm_loadu_pd(x + i), vpx);
+                __m128d dy = _mm_sub_pd(_mm_loadu_pd(y + i), vpy);
+                _mm_storeu_pd(out + i,
+                              _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+            }
+            for (; i < n; ++i) {
+                out[i] = std::sqrt((x[i] - px) * (x[i] - px) + (y[i] - py) * (y[i] - py));
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2
+        inline void DistPointAvx2(const double *x, const double *y, std::size_t n, double px,
+                                  double py, double *out) {
+            const __m256d vpx = _mm256_set1_pd(px), vpy = _mm256_set1_pd(py);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(x + i), vpx);
+                __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(y + i), vpy);
+                _mm256_storeu_pd(out + i,
+                                 _mm256_sqrt_pd(_mm256_fmadd_pd(dx, dx, _mm256_mul_pd(dy, dy))));
+            }
+            for (; i < n; ++i) {
+                out[i] = std::sqrt((x[i] - px) * (x[i] - px) + (y[i] - py) * (y[i] - py));
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512
+        inline void DistPointAvx512(const double *x, const double *y, std::size_t n, double px,
+                                    double py, double *out) {
+            const __m512d vpx = _mm512_set1_pd(px), vpy = _mm512_set1_pd(py);
+            for (std::size_t i = 0; i < n; i += 8) {
+                __mmask8 m = n - i >= 8 ? 0xFF : static_cast<__mmask8>((1u << (n - i)) - 1);
+                __m512d dx = _mm512_sub_pd(_mm512_maskz_loadu_pd(m, x + i), vpx);
+                __m512d dy = _mm512_sub_pd(_mm512_maskz_loadu_pd(m, y + i), vpy);
+                __m512d sum = _mm512_fmadd_pd(dx, dx, _mm512_mul_pd(dy, dy));
+                _mm512_mask_storeu_pd(out + i, m, _mm512_sqrt_pd(sum));
+            }
+        }
+
+        // a*x + b*y: при (a, b) = (vx, vy) это скалярное, при (-vy, vx) - векторное произведение
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline void LinearSse2(const double *x, const double *y, std::size_t n, double a,
+                               double b, double *out) {
+            const __m128d va = _mm_set1_pd(a), vb = _mm_set1_pd(b);
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                _mm_storeu_pd(out + i, _mm_add_pd(_mm_mul_pd(va, _mm_loadu_pd(x + i)),
+                                                  _mm_mul_pd(vb, _mm_loadu_pd(y + i))));
+            }
+            for (; i < n; ++i) {
+                out[i] = a * x[i] + b * y[i];
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2
+        inline void LinearAvx2(const double *x, const double *y, std::size_t n, double a,
+                               double b, double *out) {
+            const __m256d va = _mm256_set1_pd(a), vb = _mm256_set1_pd(b);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                _mm256_storeu_pd(out + i,
+                                 _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i),
+                                                 _mm256_mul_pd(vb, _mm256_loadu_pd(y + i))));
+            }
+            for (; i < n; ++i) {
+                out[i] = a * x[i] + b * y[i];
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512
+        inline void LinearAvx512(const double *x, const double *y, std::size_t n, double a,
+                                 double b, double *out) {
+            const __m512d va = _mm512_set1_pd(a), vb = _mm512_set1_pd(b);
+            for (std::size_t i = 0; i < n; i += 8) {
+                __mmask8 m = n - i >= 8 ? 0xFF : static_cast<__mmask8>((1u << (n - i)) - 1);
+                _mm512_mask_storeu_pd(
+                        out + i, m,
+                        _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(m, x + i),
+                                        _mm512_mul_pd(vb, _mm512_maskz_loadu_pd(m, y + i))));
+            }
+        }
+
+        // a*x + b*y + c: ориентированное расстояние до нормированной прямой
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline void AffineSse2(const double *x, const double *y, std::size_t n, double a,
+                               double b, double c, double *out) {
+            const __m128d va = _mm_set1_pd(a), vb = _mm_set1_pd(b), vc = _mm_set1_pd(c);
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                _mm_storeu_pd(out + i,
+                              _mm_add_pd(_mm_add_pd(_mm_mul_pd(va, _mm_loadu_pd(x + i)),
+                                                    _mm_mul_pd(vb, _mm_loadu_pd(y + i))),
+                                         vc));
+            }
+            for (; i < n; ++i) {
+                out[i] = a * x[i] + b * y[i] + c;
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2
+        inline void AffineAvx2(const double *x, const double *y, std::size_t n, double a,
+                               double b, double c, double *out) {
+            const __m256d va = _mm256_set1_pd(a), vb = _mm256_set1_pd(b), vc = _mm256_set1_pd(c);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                _mm256_storeu_pd(out + i,
+                                 _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i),
+                                                 _mm256_fmadd_pd(vb, _mm256_loadu_pd(y + i), vc)));
+            }
+            for (; i < n; ++i) {
+                out[i] = a * x[i] + b * y[i] + c;
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512
+        inline void AffineAvx512(const double *x, const double *y, std::size_t n, double a,
+                                 double b, double c, double *out) {
+            const __m512d va = _mm512_set1_pd(a), vb = _mm512_set1_pd(b), vc = _mm512_set1_pd(c);
+            for (std::size_t i = 0; i < n; i += 8) {
+                __mmask8 m = n - i >= 8 ? 0xFF : static_cast<__mmask8>((1u << (n - i)) - 1);
+                _mm512_mask_storeu_pd(
+                        out + i, m,
+                        _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(m, x + i),
+                                        _mm512_fmadd_pd(vb, _mm512_maskz_loadu_pd(m, y + i), vc)));
+            }
+        }
+
+        // Знак a*x + b*y + c с зоной нечувствительности eps: 1, -1 или 0.
+        inline void WriteSides(unsigned positive, unsigned negative, int lanes, int8_t *out) {
+            for (int k = 0; k < lanes; ++k) {
+                out[k] = static_cast<int8_t>(((positive >> k) & 1u) - ((negative >> k) & 1u));
+            }
+        }
+
+        // Знак (a*x + b*y) + c в том же порядке округлений, что и в SideOfLine. Произведения
+        // в отдельных выражениях, чтобы их не слил в FMA и clang.
+        inline int8_t SideOfValue(double x, double y, double a, double b, double c, double eps) {
+            double ax = a * x;
+            double by = b * y;
+            double v = ax + by + c;
+            return static_cast<int8_t>((v >= eps) - (v <= -eps));
+        }
+
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline void SideSse2(const double *x, const double *y, std::size_t n, double a, double b,
+                             double c, double eps, int8_t *out) {
+            const __m128d va = _mm_set1_pd(a), vb = _mm_set1_pd(b), vc = _mm_set1_pd(c);
+            const __m128d veps = _mm_set1_pd(eps), vneps = _mm_set1_pd(-eps);
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2) {
+                __m128d v = _mm_add_pd(_mm_add_pd(_mm_mul_pd(va, _mm_loadu_pd(x + i)),
+                                                  _mm_mul_pd(vb, _mm_loadu_pd(y + i))),
+                                       vc);
+                WriteSides(_mm_movemask_pd(_mm_cmpge_pd(v, veps)),
+                           _mm_movemask_pd(_mm_cmple_pd(v, vneps)), 2, out + i);
+            }
+            for (; i < n; ++i) {
+                out[i] = SideOfValue(x[i], y[i], a, b, c, eps);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline void SideAvx2(const double *x, const double *y, std::size_t n, double a, double b,
+                             double c, double eps, int8_t *out) {
+            const __m256d va = _mm256_set1_pd(a), vb = _mm256_set1_pd(b), vc = _mm256_set1_pd(c);
+            const __m256d veps = _mm256_set1_pd(eps), vneps = _mm256_set1_pd(-eps);
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256d ax = _mm256_mul_pd(va, _mm256_loadu_pd(x + i));
+                __m256d by = _mm256_mul_pd(vb, _mm256_loadu_pd(y + i));
+                __m256d v = _mm256_add_pd(_mm256_add_pd(ax, by), vc);
+                WriteSides(_mm256_movemask_pd(_mm256_cmp_pd(v, veps, _CMP_GE_OQ)),
+                           _mm256_movemask_pd(_mm256_cmp_pd(v, vneps, _CMP_LE_OQ)), 4, out + i);
+            }
+            for (; i < n; ++i) {
+                out[i] = SideOfValue(x[i], y[i], a, b, c, eps);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline void SideAvx512(const double *x, const double *y, std::size_t n, double a,
+                               double b, double c, double eps, int8_t *out) {
+            const __m512d va = _mm512_set1_pd(a), vb = _mm512_set1_pd(b), vc = _mm512_set1_pd(c);
+            const __m512d veps = _mm512_set1_pd(eps), vneps = _mm512_set1_pd(-eps);
+            for (std::size_t i = 0; i < n; i += 8) {
+                int lanes = n - i >= 8 ? 8 : static_cast<int>(n - i);
+                __mmask8 m = static_cast<__mmask8>((1u << lanes) - 1);
+                __m512d ax = _mm512_mul_pd(va, _mm512_maskz_loadu_pd(m, x + i));
+                __m512d by = _mm512_mul_pd(vb, _mm512_maskz_loadu_pd(m, y + i));
+                __m512d v = _mm512_add_pd(_mm512_add_pd(ax, by), vc);
+                WriteSides(_mm512_mask_cmp_pd_mask(m, v, veps, _CMP_GE_OQ),
+                           _mm512_mask_cmp_pd_mask(m, v, vneps, _CMP_LE_OQ), lanes, out + i);
+            }
+        }
+#endif
+    }
+
+    /*!
+    \defgroup batch Пакетные функции
+    \brief Те же операции, что и в основном модуле, но сразу для всех точек BasicPointCloud.
+    Результат для i-й точки записывается в out[i], буфер out должен вмещать points.Size()
+    элементов. Для double выбирается ядро по GetSimdLevel().
+    */
+    ///@{
+
+    /*!
+    Расстояния от прямой до каждой точки набора.
+    \param[in] line Прямая
+    \param[in] points Точки
+    \param[out] out Расстояния
+    */
+    template <typename T>
+    void Dist(const BasicLine<T> &line, const BasicPointCloud<T> &points, RealType<T> *out) {
+        const T *x = points.X();
+        const T *y = points.Y();
+        std::size_t n = points.Size();
+        RealType<T> inv = 1 / line.GetNormal().Length();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::DistLineAvx512(x, y, n, line.A_, line.B_, line.C_, inv, out);
+                case SimdLevel::kAvx2:
+                    return detail::DistLineAvx2(x, y, n, line.A_, line.B_, line.C_, inv, out);
+                case SimdLevel::kSse2:
+                    return detail::DistLineSse2(x, y, n, line.A_, line.B_, line.C_, inv, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = std::abs(static_cast<RealType<T>>(line.A_ * x[i] + line.B_ * y[i] + line.C_)) *
+                     inv;
+        }
+    }
+
+    /*!
+    Расстояния от точки v до каждой точки набора.
+    \param[in] v Точка
+    \param[in] points Точки
+    \param[out] out Расстояния
+    */
+    template <typename T>
+    void Dist(const BasicVector<T> &v, const BasicPointCloud<T> &points, RealType<T> *out) {
+        const T *x = points.X();
+        const T *y = points.Y();
+        std::size_t n = points.Size();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::DistPointAvx512(x, y, n, v.x_, v.y_, out);
+                case SimdLevel::kAvx2:
+                    return detail::DistPointAvx2(x, y, n, v.x_, v.y_, out);
+                case SimdLevel::kSse2:
+                    return detail::DistPointSse2(x, y, n, v.x_, v.y_, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = Dist(v, BasicVector<T>(x[i], y[i]));
+        }
+    }
+
+    /*!
+    Скалярные произведения v на каждую точку набора.
+    \param[in] v Вектор
+    \param[in] points Точки
+    \param[out] out ScalarMultiplication(v, points[i])
+    */
+    template <typename T>
+    void ScalarMultiplication(const BasicVector<T> &v, const BasicPointCloud<T> &points, T *out) {
+        const T *x = points.X();
+        const T *y = points.Y();
+        std::size_t n = points.Size();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::LinearAvx512(x, y, n, v.x_, v.y_, out);
+                case SimdLevel::kAvx2:
+                    return detail::LinearAvx2(x, y, n, v.x_, v.y_, out);
+                case SimdLevel::kSse2:
+                    return detail::LinearSse2(x, y, n, v.x_, v.y_, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = v.x_ * x[i] + v.y_ * y[i];
+        }
+    }
+
+    /*!
+    Векторные произведения v на каждую точку набора.
+    \param[in] v Вектор
+    \param[in] points Точки
+    \param[out] out VectorMultiplication(v, points[i])
+    */
+    template <typename T>
+    void VectorMultiplication(const BasicVector<T> &v, const BasicPointCloud<T> &points, T *out) {
+        const T *x = points.X();
+        const T *y = points.Y();
+        std::size_t n = points.Size();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::LinearAvx512(x, y, n, -v.y_, v.x_, out);
+                case SimdLevel::kAvx2:
+                    return detail::LinearAvx2(x, y, n, -v.y_, v.x_, out);
+                case SimdLevel::kSse2:
+                    return detail::LinearSse2(x, y, n, -v.y_, v.x_, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = v.x_ * y[i] - v.y_ * x[i];
+        }
+    }
+
+    /*!
+    Стороны прямой, на которых лежат точки набора, как в SideOfLine. С
+    OLYMP_GEOMETRY_EXACT_PREDICATES векторные ядра не используются, и каждая точка
+    проверяется точным SideOfLine.
+    \param[in] line Прямая
+    \param[in] points Точки
+    \param[out] out 1, -1 или 0 для каждой точки
+    */
+    template <typename T>
+    void SideOfLine(const BasicLine<T> &line, const BasicPointCloud<T> &points, int8_t *out) {
+        const T *x = points.X();
+        const T *y = points.Y();
+        std::size_t n = points.Size();
+        // С точными предикатами SideOfLine считает знак точно, а не с полосой kEps.
+#if OLYMP_GEOMETRY_X86_SIMD && !defined(OLYMP_GEOMETRY_EXACT_PREDICATES)
+        if constexpr (std::is_same_v<T, double>) {
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::SideAvx512(x, y, n, line.A_, line.B_, line.C_, kEpsOf<T>, out);
+                case SimdLevel::kAvx2:
+                    return detail::SideAvx2(x, y, n, line.A_, line.B_, line.C_, kEpsOf<T>, out);
+                case SimdLevel::kSse2:
+                    return detail::SideSse2(x, y, n, line.A_, line.B_, line.C_, kEpsOf<T>, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = static_cast<int8_t>(SideOfLine(line, BasicVector<T>(x[i], y[i])));
+        }
+    }
+
+    /*!
+    Ориентированные расстояния от нормированной прямой до каждой точки набора, как в
+    SignedDist. Для double это одно умножение-сложение на точку.
+    \param[in] line Прямая
+    \param[in] points Точки
+    \param[out] out Расстояния со знаком
+    */
+    template <typename T>
+    void SignedDist(const BasicNormalizedLine<T> &line, const BasicPointCloud<T> &points,
+                    RealType<T> *out) {
+        const T *x = points.X();
+        const T *y = points.Y();
+        std::size_t n = points.Size();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::AffineAvx512(x, y, n, line.A_, line.B_, line.C_, out);
+                case SimdLevel::kAvx2:
+                    return detail::AffineAvx2(x, y, n, line.A_, line.B_, line.C_, out);
+                case SimdLevel::kSse2:
+                    return detail::AffineSse2(x, y, n, line.A_, line.B_, line.C_, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = SignedDist(line, BasicVector<T>(x[i], y[i]));
+        }
+    }
+
+    /*!
+    Расстояния от нормированной прямой до каждой точки набора.
+    \param[in] line Прямая
+    \param[in] points Точки
+    \param[out] out Расстояния
+    */
+    template <typename T>
+    void Dist(const BasicNormalizedLine<T> &line, const BasicPointCloud<T> &points,
+              RealType<T> *out) {
+        const T *x = points.X();
+        const T *y = points.Y();
+        std::size_t n = points.Size();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::DistLineAvx512(x, y, n, line.A_, line.B_, line.C_, 1, out);
+                case SimdLevel::kAvx2:
+                    return detail::DistLineAvx2(x, y, n, line.A_, line.B_, line.C_, 1, out);
+                case SimdLevel::kSse2:
+                    return detail::DistLineSse2(x, y, n, line.A_, line.B_, line.C_, 1, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = Dist(line, BasicVector<T>(x[i], y[i]));
+        }
+    }
+
+    /*!
+    Стороны нормированной прямой, на которых лежат точки набора, как в SideOfLine.
+    \param[in] line Прямая
+    \param[in] points Точки
+    \param[out] out 1, -1 или 0 для каждой точки
+    */
+    template <typename T>
+    void SideOfLine(const BasicNormalizedLine<T> &line, const BasicPointCloud<T> &points,
+                    int8_t *out) {
+        const T *x = points.X();
+        const T *y = points.Y();
+        std::size_t n = points.Size();
+#if OLYMP_GEOMETRY_X86_SIMD
+        if constexpr (std::is_same_v<T, double>) {
+            const double eps = kEpsOf<T>;
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    return detail::SideAvx512(x, y, n, line.A_, line.B_, line.C_, eps, out);
+                case SimdLevel::kAvx2:
+                    return detail::SideAvx2(x, y, n, line.A_, line.B_, line.C_, eps, out);
+                case SimdLevel::kSse2:
+                    return detail::SideSse2(x, y, n, line.A_, line.B_, line.C_, eps, out);
+                case SimdLevel::kScalar:
+                    break;
+            }
+        }
+#endif
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = static_cast<int8_t>(SideOfLine(line, BasicVector<T>(x[i], y[i])));
+        }
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_POINT_CLOUD_H
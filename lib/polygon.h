@@ -0,0 +1,257 @@
+#ifndef OLYMP_GEOMETRY_POLYGON_H
+#define OLYMP_GEOMETRY_POLYGON_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "geometry-store.h"
+#include "olymp-geometry.h"
+#include "point-cloud.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Многоугольник: вершины подряд в одном массиве и вычисленные при построении
+    ориентация, удвоенная площадь и признак выпуклости.
+    \tparam T Тип координат
+    */
+    template <typename T>
+    class BasicPolygon {
+    public:
+        BasicPolygon() = default;
+
+        explicit BasicPolygon(std::vector<BasicVector<T>> vertices)
+            : vertices_(std::move(vertices)) {
+            Precompute();
+        }
+
+        BasicPolygon(std::initializer_list<BasicVector<T>> vertices) : vertices_(vertices) {
+            Precompute();
+        }
+
+        //! Копирует вершины фигуры из BasicGeometryStore
+        explicit BasicPolygon(const BasicShapeView<T> &shape)
+            : vertices_(shape.begin(), shape.end()) {
+            Precompute();
+        }
+
+        std::size_t Size() const {
+            return vertices_.size();
+        }
+
+        const BasicVector<T> &operator[](std::size_t i) const {
+            return vertices_[i];
+        }
+
+        const std::vector<BasicVector<T>> &Vertices() const {
+            return vertices_;
+        }
+
+        //! 1, если вершины идут против часовой стрелки, -1 - если по часовой, 0 для
+        //! многоугольника нулевой площади
+        int Orientation() const {
+            return orientation_;
+        }
+
+        //! Удвоенная ориентированная площадь, положительная при обходе против часовой стрелки
+        RealType<T> DoubleSignedArea() const {
+            return double_area_;
+        }
+
+        RealType<T> Area() const {
+            return detail::Abs(double_area_) / 2;
+        }
+
+        //! true для выпуклого многоугольника ненулевой площади, вершины которого обходят
+        //! границу один раз. Подряд идущие вершины на одной прямой допускаются.
+        bool IsConvex() const {
+            return convex_;
+        }
+
+    private:
+        void Precompute() {
+            std::size_t n = vertices_.size();
+            double_area_ = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const BasicVector<T> &a = vertices_[i], &b = vertices_[i + 1 == n ? 0 : i + 1];
+                double_area_ += static_cast<RealType<T>>(VectorMultiplication(a, b));
+            }
+            orientation_ = double_area_ > 0 ? 1 : (double_area_ < 0 ? -1 : 0);
+
+            convex_ = n >= 3 && orientation_ != 0;
+            for (std::size_t i = 0; convex_ && i < n; ++i) {
+                const BasicVector<T> &a = vertices_[i];
+                const BasicVector<T> &b = vertices_[(i + 1) % n], &c = vertices_[(i + 2) % n];
+                // Все повороты в одну сторону, и веер из вершины 0 идёт по кругу один раз,
+                // иначе это самопересекающаяся звезда.
+                if (Orient2D(a, b, c) * orientation_ < 0) {
+                    convex_ = false;
+                } else if (i >= 1 && i + 1 < n &&
+                           Orient2D(vertices_[0], a, b) * orientation_ < 0) {
+                    convex_ = false;
+                }
+            }
+        }
+
+        std::vector<BasicVector<T>> vertices_;
+        RealType<T> double_area_ = 0;
+        int orientation_ = 0;
+        bool convex_ = false;
+    };
+
+    using Polygon = BasicPolygon<long double>;
+
+    namespace detail {
+        // Точка на отрезке ab с той же точностью, что и LiesOn, но без ветвлений, чтобы цикл
+        // по точкам векторизовался.
+        template <typename T>
+        bool OnEdge(const BasicVector<T> &a, const BasicVector<T> &b, T x, T y) {
+            T ex = b.x_ - a.x_, ey = b.y_ - a.y_, px = x - a.x_, py = y - a.y_;
+            RealType<T> cross = ex * py - ey * px;
+            bool between = (ex * px + ey * py >= 0) & (ex * (x - b.x_) + ey * (y - b.y_) <= 0);
+            if constexpr (std::is_integral_v<T>) {
+                return between & (cross == 0);
+            } else {
+                return between & (cross * cross < kEpsOf<T> * kEpsOf<T> * (ex * ex + ey * ey));
+            }
+        }
+
+        // Для count точек прибавляет к winding их индексы относительно многоугольника
+        // (алгоритм Сандея) и отмечает в boundary точки на границе. Внешний цикл по рёбрам,
+        // внутренний по точкам: вершины ребра остаются в регистрах.
+        template <typename T>
+        void AccumulateWinding(const BasicPolygon<T> &polygon, const T *x, const T *y,
+                               std::size_t count, int *winding, bool *boundary) {
+            std::size_t n = polygon.Size();
+            for (std::size_t e = 0; e < n; ++e) {
+                const BasicVector<T> &a = polygon[e], &b = polygon[e + 1 == n ? 0 : e + 1];
+                T ex = b.x_ - a.x_, ey = b.y_ - a.y_;
+                for (std::size_t i = 0; i < count; ++i) {
+                    T cross = ex * (y[i] - a.y_) - ey * (x[i] - a.x_);
+                    bool up = (a.y_ <= y[i]) & (b.y_ > y[i]) & (cross > 0);
+                    bool down = (a.y_ > y[i]) & (b.y_ <= y[i]) & (cross < 0);
+                    winding[i] += static_cast<int>(up) - static_cast<int>(down);
+                    boundary[i] |= OnEdge(a, b, x[i], y[i]);
+                }
+            }
+        }
+
+        // k-я вершина в обходе против часовой стрелки, начиная с вершины 0.
+        template <typename T>
+        const BasicVector<T> &CounterClockwiseVertex(const BasicPolygon<T> &polygon,
+                                                     std::size_t k) {
+            if (polygon.Orientation() > 0 || k == 0) {
+                return polygon[k];
+            }
+            return polygon[polygon.Size() - k];
+        }
+
+        // Двоичный поиск по вееру треугольников из вершины 0 за O(log n).
+        template <typename T>
+        bool ConvexContains(const BasicPolygon<T> &polygon, const BasicVector<T> &v) {
+            std::size_t n = polygon.Size();
+            auto vertex = [&polygon](std::size_t k) -> const BasicVector<T> & {
+                return CounterClockwiseVertex(polygon, k);
+            };
+            const BasicVector<T> &origin = vertex(0);
+            BasicVector<T> offset = v - origin;
+            if (VectorMultiplication(vertex(1) - origin, offset) < 0 ||
+                VectorMultiplication(vertex(n - 1) - origin, offset) > 0) {
+                // Вне угла при вершине 0, но может лежать на его сторонах.
+                return OnEdge(origin, vertex(1), v.x_, v.y_) ||
+                       OnEdge(origin, vertex(n - 1), v.x_, v.y_);
+            }
+            // Последняя вершина low, для которой v не правее луча origin -> vertex(low).
+            std::size_t low = 1, high = n - 1;
+            while (high - low > 1) {
+                std::size_t middle = (low + high) / 2;
+                if (VectorMultiplication(vertex(middle) - origin, offset) >= 0) {
+                    low = middle;
+                } else {
+                    high = middle;
+                }
+            }
+            const BasicVector<T> &a = vertex(low), &b = vertex(low + 1);
+            return VectorMultiplication(b - a, v - a) >= 0 || OnEdge(a, b, v.x_, v.y_);
+        }
+
+        constexpr std::size_t kPolygonBlock = 256;
+    }
+
+    /*!
+    \defgroup polygon Многоугольники
+    \ingroup relative_position
+    \brief Принадлежность точки многоугольнику.
+    */
+    ///@{
+
+    /*!
+    Индекс точки относительно многоугольника: сколько раз граница обходит точку против
+    часовой стрелки. Для точек на границе значение не определено.
+    \param[in] polygon Многоугольник, возможно невыпуклый и самопересекающийся
+    \param[in] v Точка
+    \return 0 для точек снаружи
+    */
+    template <typename T>
+    int WindingNumber(const BasicPolygon<T> &polygon, const BasicVector<T> &v) {
+        int winding = 0;
+        bool boundary = false;
+        detail::AccumulateWinding(polygon, &v.x_, &v.y_, 1, &winding, &boundary);
+        return winding;
+    }
+
+    /*!
+    Проверяет, лежит ли точка внутри многоугольника или на его границе. Для выпуклых
+    многоугольников работает за O(log n), для остальных - через индекс точки за O(n).
+    \param[in] polygon Многоугольник
+    \param[in] v Точка
+    \return true, если v внутри или на границе
+    */
+    template <typename T>
+    bool Contains(const BasicPolygon<T> &polygon, const BasicVector<T> &v) {
+        if (polygon.IsConvex()) {
+            return detail::ConvexContains(polygon, v);
+        }
+        int winding = 0;
+        bool boundary = false;
+        detail::AccumulateWinding(polygon, &v.x_, &v.y_, 1, &winding, &boundary);
+        return boundary || winding != 0;
+    }
+
+    /*!
+    Пакетная версия Contains для множества точек. Невыпуклый многоугольник обходится
+    блоками по несколько сотен точек: рёбра читаются один раз на блок, а цикл по точкам
+    не содержит ветвлений.
+    \param[in] polygon Многоугольник
+    \param[in] points Точки
+    \param[out] out out[i] = Contains(polygon, points[i]), массив размера points.Size()
+    */
+    template <typename T>
+    void Contains(const BasicPolygon<T> &polygon, const BasicPointCloud<T> &points, bool *out) {
+        std::size_t n = points.Size();
+        if (polygon.IsConvex()) {
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = detail::ConvexContains(polygon, points[i]);
+            }
+            return;
+        }
+        int winding[detail::kPolygonBlock];
+        for (std::size_t begin = 0; begin < n; begin += detail::kPolygonBlock) {
+            std::size_t count = std::min(detail::kPolygonBlock, n - begin);
+            std::fill(winding, winding + count, 0);
+            std::fill(out + begin, out + begin + count, false);
+            detail::AccumulateWinding(polygon, points.X() + begin, points.Y() + begin, count,
+                                      winding, out + begin);
+            for (std::size_t i = 0; i < count; ++i) {
+                out[begin + i] |= winding[i] != 0;
+            }
+        }
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_POLYGON_H
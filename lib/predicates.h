@@ -0,0 +1,266 @@
+#ifndef OLYMP_GEOMETRY_PREDICATES_H
+#define OLYMP_GEOMETRY_PREDICATES_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace olymp_geometry {
+    /*!
+    \defgroup predicates Точные предикаты
+    \brief Адаптивные предикаты в духе Шевчука: знак выражения сначала определяется по
+    обычному вычислению с оценкой погрешности, и только если оценка не позволяет решить,
+    выражение пересчитывается точно в арифметике расширений (expansions).
+
+    Если определён макрос OLYMP_GEOMETRY_EXACT_PREDICATES, на эти предикаты переходят
+    OnSameSide, OnSameSideEq, SideOfLine, IsBetween, LiesOn, Intersect и сравнение прямых,
+    и для координат с плавающей точкой результат перестаёт зависеть от kEps. Пакетные
+    SideOfLine и Intersect для BasicPointCloud и BasicSegmentCloud тогда тоже идут через
+    эти функции, минуя векторные ядра. Макрос должен быть одинаковым во всех единицах
+    трансляции программы.
+    */
+    ///@{
+
+    namespace detail {
+        inline std::atomic<uint64_t> &ExactFallbacks() {
+            static std::atomic<uint64_t> count(0);
+            return count;
+        }
+
+        // Счётчик не трогается при вычислении на этапе компиляции, иначе вырожденные случаи
+        // нельзя было бы проверять в constexpr.
+        constexpr void CountExactFallback() {
+#if defined(__GNUC__) || defined(__clang__)
+            if (__builtin_is_constant_evaluated()) {
+                return;
+            }
+#endif
+            ExactFallbacks().fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Половина расстояния от 1 до следующего числа: 2^-53 для double.
+        template <typename T>
+        constexpr T kHalfEpsilon = std::numeric_limits<T>::epsilon() / 2;
+
+        // Оценка погрешности ccwerrboundA из статьи Шевчука.
+        template <typename T>
+        constexpr T kErrorBound = (3 + 16 * kHalfEpsilon<T>) * kHalfEpsilon<T>;
+
+        // 2^ceil(p / 2) + 1, где p - число бит мантиссы: делит число на две половины,
+        // произведение которых точно.
+        template <typename T>
+        constexpr T kSplitter =
+                static_cast<T>((uint64_t{1} << ((std::numeric_limits<T>::digits + 1) / 2)) + 1);
+
+        template <typename T>
+        constexpr int Sign(T x) {
+            return (x > 0) - (x < 0);
+        }
+
+        template <typename T>
+        constexpr T Magnitude(T x) {
+            return x < 0 ? -x : x;
+        }
+
+        // a + b = x + y точно, |y| не больше половины младшего разряда x.
+        template <typename T>
+        constexpr void TwoSum(T a, T b, T &x, T &y) {
+            x = a + b;
+            T b_virtual = x - a;
+            T a_virtual = x - b_virtual;
+            y = (a - a_virtual) + (b - b_virtual);
+        }
+
+        template <typename T>
+        constexpr void Split(T a, T &high, T &low) {
+            T c = kSplitter<T> * a;
+            high = c - (c - a);
+            low = a - high;
+        }
+
+        // a * b = x + y точно (алгоритм Деккера).
+        template <typename T>
+        constexpr void TwoProduct(T a, T b, T &x, T &y) {
+            x = a * b;
+            T a_high = 0, a_low = 0, b_high = 0, b_low = 0;
+            Split(a, a_high, a_low);
+            Split(b, b_high, b_low);
+            T error = x - a_high * b_high - a_low * b_high - a_high * b_low;
+            y = a_low * b_low - error;
+        }
+
+        // Знак точной суммы слагаемых. Сумма накапливается в неперекрывающемся расширении
+        // (Grow-Expansion с удалением нулей), знак которого равен знаку старшей компоненты.
+        template <typename T, std::size_t N>
+        constexpr int ExactSumSign(const T (&terms)[N]) {
+            T expansion[N] = {};
+            std::size_t length = 0;
+            for (std::size_t t = 0; t < N; ++t) {
+                T q = terms[t];
+                std::size_t k = 0;
+                for (std::size_t i = 0; i < length; ++i) {
+                    T h = 0;
+                    TwoSum(q, expansion[i], q, h);
+                    if (h != 0) {
+                        expansion[k++] = h;
+                    }
+                }
+                if (q != 0) {
+                    expansion[k++] = q;
+                }
+                length = k;
+            }
+            return length == 0 ? 0 : Sign(expansion[length - 1]);
+        }
+    }
+
+    /*!
+    Знак определителя a * d - b * c.
+    \return 1, -1 или 0
+    */
+    template <typename T>
+    constexpr int DeterminantSign(T a, T b, T c, T d) {
+        if constexpr (std::is_integral_v<T>) {
+            return detail::Sign(a * d - b * c);
+        } else {
+            T left = a * d, right = b * c, det = left - right;
+            T sum = detail::Magnitude(left) + detail::Magnitude(right);
+            if (det > detail::kErrorBound<T> * sum || -det > detail::kErrorBound<T> * sum ||
+                sum == 0) {
+                return detail::Sign(det);
+            }
+            detail::CountExactFallback();
+            T terms[4] = {};
+            detail::TwoProduct(a, d, terms[0], terms[1]);
+            detail::TwoProduct(-b, c, terms[2], terms[3]);
+            return detail::ExactSumSign(terms);
+        }
+    }
+
+    /*!
+    Знак a * x + b * y + c, то есть сторона прямой ax + by + c = 0, на которой лежит (x, y).
+    \return 1, -1 или 0
+    */
+    template <typename T>
+    constexpr int LinearFormSign(T a, T x, T b, T y, T c) {
+        if constexpr (std::is_integral_v<T>) {
+            return detail::Sign(a * x + b * y + c);
+        } else {
+            T ax = a * x, by = b * y, value = ax + by + c;
+            T magnitude = detail::Magnitude(ax) + detail::Magnitude(by) + detail::Magnitude(c);
+            if (value > detail::kErrorBound<T> * magnitude ||
+                -value > detail::kErrorBound<T> * magnitude || magnitude == 0) {
+                return detail::Sign(value);
+            }
+            detail::CountExactFallback();
+            T terms[5] = {};
+            detail::TwoProduct(a, x, terms[0], terms[1]);
+            detail::TwoProduct(b, y, terms[2], terms[3]);
+            terms[4] = c;
+            return detail::ExactSumSign(terms);
+        }
+    }
+
+    /*!
+    Ориентация тройки точек: знак векторного произведения (b - a) x (c - a).
+    \return 1, если a, b, c идут против часовой стрелки, -1 - если по часовой, 0 - если
+    точки лежат на одной прямой
+    */
+    template <typename T>
+    constexpr int Orient2D(T ax, T ay, T bx, T by, T cx, T cy) {
+        if constexpr (std::is_integral_v<T>) {
+            return detail::Sign((bx - ax) * (cy - ay) - (by - ay) * (cx - ax));
+        } else {
+            T left = (ax - cx) * (by - cy), right = (ay - cy) * (bx - cx), det = left - right;
+            T sum = 0;
+            if (left > 0) {
+                if (right <= 0) {
+                    return detail::Sign(det);
+                }
+                sum = left + right;
+            } else if (left < 0) {
+                if (right >= 0) {
+                    return detail::Sign(det);
+                }
+                sum = -left - right;
+            } else {
+                return detail::Sign(det);
+            }
+            if (det >= detail::kErrorBound<T> * sum || -det >= detail::kErrorBound<T> * sum) {
+                return detail::Sign(det);
+            }
+            // (b - a) x (c - a) = a x b + b x c + c x a, каждое произведение раскладывается
+            // в два слагаемых без потери точности.
+            detail::CountExactFallback();
+            T terms[12] = {};
+            detail::TwoProduct(ax, by, terms[0], terms[1]);
+            detail::TwoProduct(-ay, bx, terms[2], terms[3]);
+            detail::TwoProduct(bx, cy, terms[4], terms[5]);
+            detail::TwoProduct(-by, cx, terms[6], terms[7]);
+            detail::TwoProduct(cx, ay, terms[8], terms[9]);
+            detail::TwoProduct(-cy, ax, terms[10], terms[11]);
+            return detail::ExactSumSign(terms);
+        }
+    }
+
+    /*!
+    Знак определителя 3x3 по строкам (a1, b1, c1), (a2, b2, c2), (a3, b3, c3). Для
+    коэффициентов прямых a * x + b * y + c = 0 он, умноженный на DeterminantSign(a1, b1, a2,
+    b2), даёт сторону третьей прямой, на которой лежит точка пересечения первых двух.
+    Целые коэффициенты переводятся в RealType, где произведения трёх чисел не
+    переполняются, а сами коэффициенты до 2^63 представимы точно.
+    \return 1, -1 или 0
+    */
+    template <typename T>
+    constexpr int Determinant3Sign(T a1, T b1, T c1, T a2, T b2, T c2, T a3, T b3, T c3) {
+        if constexpr (std::is_integral_v<T>) {
+            using Real = long double;
+            return Determinant3Sign<Real>(a1, b1, c1, a2, b2, c2, a3, b3, c3);
+        } else {
+            T products[6] = {a1 * b2 * c3, -a1 * b3 * c2, b1 * c2 * a3,
+                             -b1 * a2 * c3, c1 * a2 * b3, -c1 * b2 * a3};
+            T det = 0, sum = 0;
+            for (T product : products) {
+                det += product;
+                sum += detail::Magnitude(product);
+            }
+            // Относительная ошибка произведения трёх чисел не больше 2u, суммы шести - ещё 5u.
+            T bound = (8 + 64 * detail::kHalfEpsilon<T>) * detail::kHalfEpsilon<T>;
+            if (det > bound * sum || -det > bound * sum || sum == 0) {
+                return detail::Sign(det);
+            }
+            // Произведение трёх чисел точно раскладывается в четыре слагаемых.
+            detail::CountExactFallback();
+            const T factors[6][3] = {{a1, b2, c3}, {-a1, b3, c2}, {b1, c2, a3},
+                                     {-b1, a2, c3}, {c1, a2, b3}, {-c1, b2, a3}};
+            T terms[24] = {};
+            for (std::size_t i = 0; i < 6; ++i) {
+                T high = 0, low = 0;
+                detail::TwoProduct(factors[i][0], factors[i][1], high, low);
+                detail::TwoProduct(high, factors[i][2], terms[4 * i], terms[4 * i + 1]);
+                detail::TwoProduct(low, factors[i][2], terms[4 * i + 2], terms[4 * i + 3]);
+            }
+            return detail::ExactSumSign(terms);
+        }
+    }
+
+    /*!
+    \return Сколько раз с начала программы (или с последнего сброса) предикатам не хватило
+    быстрой проверки и пришлось считать точно
+    */
+    inline uint64_t ExactFallbackCount() {
+        return detail::ExactFallbacks().load(std::memory_order_relaxed);
+    }
+
+    /*!
+    Обнуляет счётчик ExactFallbackCount().
+    */
+    inline void ResetExactFallbackCount() {
+        detail::ExactFallbacks().store(0, std::memory_order_relaxed);
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_PREDICATES_H
@@ -0,0 +1,220 @@
+#ifndef OLYMP_GEOMETRY_ROTATING_CALIPERS_H
+#define OLYMP_GEOMETRY_ROTATING_CALIPERS_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "olymp-geometry.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Диаметр выпуклого многоугольника: самая далёкая пара вершин.
+    */
+    template <typename T>
+    struct CaliperDiameter {
+        //! Индексы вершин пары
+        std::size_t first_ = 0, second_ = 0;
+        //! Квадрат расстояния между ними
+        RealType<T> distance_squared_ = 0;
+    };
+
+    /*!
+    \brief Ширина выпуклого многоугольника: наименьшее расстояние между двумя параллельными
+    опорными прямыми. Одна из них всегда проходит через ребро.
+    */
+    template <typename T>
+    struct CaliperWidth {
+        //! Ребро от вершины edge_ к следующей
+        std::size_t edge_ = 0;
+        //! Самая далёкая от прямой ребра вершина
+        std::size_t vertex_ = 0;
+        RealType<T> width_ = 0;
+    };
+
+    /*!
+    \brief Описанный прямоугольник наименьшей площади. Одна из его сторон всегда лежит на
+    ребре многоугольника.
+    */
+    template <typename T>
+    struct BoundingRectangle {
+        //! Углы против часовой стрелки, первые два лежат на прямой ребра edge_
+        std::array<BasicVector<RealType<T>>, 4> corners_;
+        std::size_t edge_ = 0;
+        RealType<T> area_ = 0;
+    };
+
+    namespace detail {
+        template <typename T>
+        std::size_t NextVertex(const std::vector<BasicVector<T>> &hull, std::size_t i) {
+            return i + 1 == hull.size() ? 0 : i + 1;
+        }
+
+        template <typename T>
+        BasicVector<T> HullEdge(const std::vector<BasicVector<T>> &hull, std::size_t i) {
+            return hull[NextVertex(hull, i)] - hull[i];
+        }
+
+        // Сдвигает k по кругу, пока value(k) растёт. Для выпуклого многоугольника это
+        // движение к вершине, экстремальной в заданном направлении.
+        template <typename T, typename Value>
+        std::size_t AdvanceWhileGrowing(const std::vector<BasicVector<T>> &hull, std::size_t k,
+                                        const Value &value) {
+            for (std::size_t steps = 0; steps < hull.size(); ++steps) {
+                std::size_t next = NextVertex(hull, k);
+                if (!(value(hull[next]) > value(hull[k]))) {
+                    break;
+                }
+                k = next;
+            }
+            return k;
+        }
+    }
+
+    /*!
+    \defgroup rotating_calipers Вращающиеся калиперы
+    \brief Диаметр, ширина и описанный прямоугольник выпуклого многоугольника за O(n).
+    Вершины должны быть выпуклым многоугольником против часовой стрелки, например
+    результатом ConvexHull. Считается только через ScalarMultiplication и
+    VectorMultiplication, без тригонометрии; ширина - единственное место с корнем.
+    */
+    ///@{
+
+    /*!
+    \param[in] hull Вершины выпуклого многоугольника против часовой стрелки
+    \return Самая далёкая пара вершин. Для одной вершины - (0, 0)
+    */
+    template <typename T>
+    CaliperDiameter<T> Diameter(const std::vector<BasicVector<T>> &hull) {
+        CaliperDiameter<T> best;
+        std::size_t n = hull.size();
+        if (n < 2) {
+            return best;
+        }
+        auto consider = [&](std::size_t a, std::size_t b) {
+            RealType<T> d = DistSquared(hull[a], hull[b]);
+            if (d > best.distance_squared_) {
+                best = {std::min(a, b), std::max(a, b), d};
+            }
+        };
+        consider(0, 1);
+        // Для каждого ребра i - самая далёкая от его прямой вершина j: пары (i, j) и
+        // (i + 1, j) - антиподальные, и диаметр среди них.
+        std::size_t j = 1;
+        for (std::size_t i = 0; i < n; ++i) {
+            BasicVector<T> edge = detail::HullEdge(hull, i);
+            auto height = [&](const BasicVector<T> &p) {
+                return VectorMultiplication(edge, p - hull[i]);
+            };
+            j = detail::AdvanceWhileGrowing(hull, j, height);
+            consider(i, j);
+            consider(detail::NextVertex(hull, i), j);
+            // Противоположное ребро параллельно: его второй конец тоже антиподален.
+            std::size_t next = detail::NextVertex(hull, j);
+            if (!(height(hull[next]) < height(hull[j]))) {
+                consider(i, next);
+                consider(detail::NextVertex(hull, i), next);
+            }
+        }
+        return best;
+    }
+
+    /*!
+    \param[in] hull Вершины выпуклого многоугольника против часовой стрелки
+    \return Ширина и задающие её ребро и вершина. Для меньше чем трёх вершин ширина 0
+    */
+    template <typename T>
+    CaliperWidth<T> Width(const std::vector<BasicVector<T>> &hull) {
+        CaliperWidth<T> best;
+        std::size_t n = hull.size();
+        if (n < 3) {
+            return best;
+        }
+        // Сравниваем квадраты высот cross^2 / |edge|^2, корень извлекается один раз.
+        RealType<T> best_squared = std::numeric_limits<RealType<T>>::infinity();
+        std::size_t j = 1;
+        for (std::size_t i = 0; i < n; ++i) {
+            BasicVector<T> edge = detail::HullEdge(hull, i);
+            auto height = [&](const BasicVector<T> &p) {
+                return VectorMultiplication(edge, p - hull[i]);
+            };
+            j = detail::AdvanceWhileGrowing(hull, j, height);
+            RealType<T> cross = height(hull[j]);
+            RealType<T> squared = cross * cross / ScalarMultiplication(edge, edge);
+            if (squared < best_squared) {
+                best_squared = squared;
+                best.edge_ = i;
+                best.vertex_ = j;
+            }
+        }
+        best.width_ = std::sqrt(best_squared);
+        return best;
+    }
+
+    /*!
+    Описанный прямоугольник наименьшей площади. Для каждого ребра три калипера - самые
+    далёкие вершины вдоль ребра, против него и от его прямой - только двигаются вперёд,
+    поэтому всего O(n) шагов. Углы считаются без нормировки направления ребра.
+    \param[in] hull Вершины выпуклого многоугольника против часовой стрелки
+    \return Прямоугольник. Для меньше чем трёх вершин - вырожденный, нулевой площади
+    */
+    template <typename T>
+    BoundingRectangle<T> MinAreaRectangle(const std::vector<BasicVector<T>> &hull) {
+        using Point = BasicVector<RealType<T>>;
+        BoundingRectangle<T> best;
+        std::size_t n = hull.size();
+        if (n < 3) {
+            if (n > 0) {
+                Point a(hull[0]), b(hull[n - 1]);
+                best.corners_ = {a, b, b, a};
+            }
+            return best;
+        }
+        best.area_ = std::numeric_limits<RealType<T>>::infinity();
+        std::size_t right = 1, top = 1, left = 1;
+        for (std::size_t i = 0; i < n; ++i) {
+            BasicVector<T> edge = detail::HullEdge(hull, i);
+            auto along = [&](const BasicVector<T> &p) {
+                return ScalarMultiplication(edge, p - hull[i]);
+            };
+            auto height = [&](const BasicVector<T> &p) {
+                return VectorMultiplication(edge, p - hull[i]);
+            };
+            auto against = [&](const BasicVector<T> &p) { return -along(p); };
+            right = detail::AdvanceWhileGrowing(hull, right, along);
+            if (i == 0) {
+                top = right;
+            }
+            top = detail::AdvanceWhileGrowing(hull, top, height);
+            if (i == 0) {
+                left = top;
+            }
+            left = detail::AdvanceWhileGrowing(hull, left, against);
+
+            // В координатах (edge, edge.GetPerpendicular() против часовой) с началом в hull[i]
+            // прямоугольник - [low, high] x [0, up], все длины в единицах |edge|^2.
+            RealType<T> length = ScalarMultiplication(edge, edge);
+            RealType<T> low = along(hull[left]), high = along(hull[right]);
+            RealType<T> up = height(hull[top]);
+            RealType<T> area = (high - low) * up / length;
+            if (area < best.area_) {
+                Point origin(hull[i]), e(edge), normal(-e.y_, e.x_);
+                auto corner = [&](RealType<T> s, RealType<T> t) {
+                    return Point(origin.x_ + (e.x_ * s + normal.x_ * t) / length,
+                                 origin.y_ + (e.y_ * s + normal.y_ * t) / length);
+                };
+                best.corners_ = {corner(low, 0), corner(high, 0), corner(high, up),
+                                 corner(low, up)};
+                best.edge_ = i;
+                best.area_ = area;
+            }
+        }
+        return best;
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_ROTATING_CALIPERS_H
@@ -0,0 +1,364 @@
+#ifndef OLYMP_GEOMETRY_SEGMENT_BVH_H
+#define OLYMP_GEOMETRY_SEGMENT_BVH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "parallel.h"
+
+namespace olymp_geometry {
+    namespace detail {
+        // Сколько запросов обрабатывает один поток как минимум.
+        constexpr std::size_t kBvhGrain = 1024;
+
+        // Ограничивающий прямоугольник со сторонами, параллельными осям.
+        template <typename T>
+        struct Box {
+            T min_x_, min_y_, max_x_, max_y_;
+
+            static Box Of(const BasicSegment<T> &s) {
+                return {std::min(s.a_.x_, s.b_.x_), std::min(s.a_.y_, s.b_.y_),
+                        std::max(s.a_.x_, s.b_.x_), std::max(s.a_.y_, s.b_.y_)};
+            }
+
+            void Extend(const Box &other) {
+                min_x_ = std::min(min_x_, other.min_x_);
+                min_y_ = std::min(min_y_, other.min_y_);
+                max_x_ = std::max(max_x_, other.max_x_);
+                max_y_ = std::max(max_y_, other.max_y_);
+            }
+
+            bool Overlaps(const Box &other, T margin) const {
+                return min_x_ - margin <= other.max_x_ && other.min_x_ <= max_x_ + margin &&
+                       min_y_ - margin <= other.max_y_ && other.min_y_ <= max_y_ + margin;
+            }
+
+            // Квадрат расстояния от точки до прямоугольника, 0 для точек внутри.
+            RealType<T> DistSquared(const BasicVector<T> &v) const {
+                RealType<T> dx = std::max<RealType<T>>(
+                        {static_cast<RealType<T>>(min_x_) - v.x_, 0,
+                         static_cast<RealType<T>>(v.x_) - max_x_});
+                RealType<T> dy = std::max<RealType<T>>(
+                        {static_cast<RealType<T>>(min_y_) - v.y_, 0,
+                         static_cast<RealType<T>>(v.y_) - max_y_});
+                return dx * dx + dy * dy;
+            }
+
+            RealType<T> CenterX() const {
+                return (static_cast<RealType<T>>(min_x_) + max_x_) / 2;
+            }
+
+            RealType<T> CenterY() const {
+                return (static_cast<RealType<T>>(min_y_) + max_y_) / 2;
+            }
+        };
+
+        // Чередует биты x и y: близкие точки получают близкие коды (кривая Мортона).
+        inline uint32_t MortonCode(uint32_t x, uint32_t y) {
+            auto spread = [](uint32_t v) {
+                v &= 0xffff;
+                v = (v | (v << 8)) & 0x00ff00ff;
+                v = (v | (v << 4)) & 0x0f0f0f0f;
+                v = (v | (v << 2)) & 0x33333333;
+                v = (v | (v << 1)) & 0x55555555;
+                return v;
+            };
+            return spread(x) | (spread(y) << 1);
+        }
+    }
+
+    /*!
+    \defgroup segment_bvh Иерархия ограничивающих прямоугольников
+    \ingroup relative_position
+    \brief Статический индекс над множеством отрезков для поиска ближайшего отрезка,
+    отрезков в окрестности точки и отрезков, пересекающих данный.
+    */
+    ///@{
+
+    /*!
+    \brief R-дерево над отрезками, упакованное алгоритмом Sort-Tile-Recursive: на каждом
+    уровне прямоугольники сортируются по x, режутся на вертикальные полосы, внутри полос
+    сортируются по y и группируются по kNodeSize. Узлы лежат в одном массиве, дети узла идут
+    подряд, а листья ссылаются на отрезки переупорядоченного массива.
+
+    Запросы возвращают индексы отрезков во входном массиве.
+    */
+    template <typename T>
+    class BasicSegmentBvh {
+    public:
+        //! Максимальное число детей узла и отрезков в листе
+        static constexpr std::size_t kNodeSize = 8;
+
+        BasicSegmentBvh() = default;
+
+        explicit BasicSegmentBvh(const std::vector<BasicSegment<T>> &segments) {
+            std::size_t n = segments.size();
+            if (n == 0) {
+                return;
+            }
+            // Уровень листьев: упаковываем сами отрезки.
+            std::vector<Item> items(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                items[i] = {detail::Box<T>::Of(segments[i]), i};
+            }
+            PackLevel(items);
+            segments_.resize(n);
+            ids_.resize(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                segments_[i] = segments[items[i].id_];
+                ids_[i] = items[i].id_;
+            }
+            std::size_t level_begin = 0;
+            for (std::size_t first = 0; first < n; first += kNodeSize) {
+                nodes_.push_back(MakeNode(items, first, std::min(n, first + kNodeSize), true));
+            }
+            // Верхние уровни: упаковываем узлы предыдущего уровня, пока не останется корень.
+            while (nodes_.size() - level_begin > 1) {
+                std::size_t level_end = nodes_.size();
+                items.clear();
+                for (std::size_t i = level_begin; i < level_end; ++i) {
+                    items.push_back({nodes_[i].box_, i});
+                }
+                PackLevel(items);
+                std::vector<Node> level(nodes_.begin() + level_begin, nodes_.begin() + level_end);
+                for (std::size_t i = 0; i < items.size(); ++i) {
+                    nodes_[level_begin + i] = level[items[i].id_ - level_begin];
+                }
+                for (std::size_t first = 0; first < items.size(); first += kNodeSize) {
+                    std::size_t last = std::min(items.size(), first + kNodeSize);
+                    Node node = MakeNode(items, first, last, false);
+                    node.first_ = level_begin + first;
+                    nodes_.push_back(node);
+                }
+                level_begin = level_end;
+            }
+        }
+
+        std::size_t Size() const {
+            return segments_.size();
+        }
+
+        /*!
+        Ближайший к точке отрезок: узлы обходятся в порядке расстояния до их прямоугольников.
+        \param[in] v Точка
+        \return Индекс отрезка с наименьшим Dist(segment, v). Индекс не должен быть пустым
+        */
+        std::size_t Nearest(const BasicVector<T> &v) const {
+            using Entry = std::pair<RealType<T>, std::size_t>;
+            std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+            queue.push({0, nodes_.size() - 1});
+            RealType<T> best = std::numeric_limits<RealType<T>>::infinity();
+            std::size_t best_position = 0;
+            while (!queue.empty() && queue.top().first < best) {
+                const Node &node = nodes_[queue.top().second];
+                queue.pop();
+                for (std::size_t i = node.first_; i < node.first_ + node.count_; ++i) {
+                    if (node.leaf_) {
+                        RealType<T> d = DistSquared(segments_[i], v);
+                        if (d < best) {
+                            best = d;
+                            best_position = i;
+                        }
+                    } else {
+                        RealType<T> d = nodes_[i].box_.DistSquared(v);
+                        if (d < best) {
+                            queue.push({d, i});
+                        }
+                    }
+                }
+            }
+            return ids_[best_position];
+        }
+
+        /*!
+        \param[in] v Точка
+        \param[in] distance Расстояние
+        \return Индексы отрезков, для которых Dist(segment, v) <= distance, по возрастанию
+        */
+        std::vector<std::size_t> WithinDistance(const BasicVector<T> &v,
+                                                RealType<T> distance) const {
+            std::vector<std::size_t> result;
+            RealType<T> limit = distance * distance;
+            Visit([&](const detail::Box<T> &box) { return box.DistSquared(v) <= limit; },
+                  [&](std::size_t i) {
+                      if (DistSquared(segments_[i], v) <= limit) {
+                          result.push_back(ids_[i]);
+                      }
+                  });
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        /*!
+        Отрезки, пересекающие данный. Прямоугольники отсекаются с запасом kEpsOf<T>, а в
+        листьях проверка идёт через Intersect.
+        \param[in] segment Отрезок запроса
+        \return Индексы отрезков, для которых Intersect(segment, s) == true, по возрастанию
+        */
+        std::vector<std::size_t> Intersecting(const BasicSegment<T> &segment) const {
+            std::vector<std::size_t> result;
+            detail::Box<T> query = detail::Box<T>::Of(segment);
+            T margin = static_cast<T>(kEpsOf<T>);
+            Visit([&](const detail::Box<T> &box) { return box.Overlaps(query, margin); },
+                  [&](std::size_t i) {
+                      if (Intersect(segment, segments_[i])) {
+                          result.push_back(ids_[i]);
+                      }
+                  });
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        /*!
+        Пакетная версия Nearest. Запросы обрабатываются в нескольких потоках в порядке кривой
+        Мортона, чтобы соседние запросы проходили по одним и тем же узлам, а ответы
+        возвращаются в исходном порядке.
+        */
+        std::vector<std::size_t> Nearest(const std::vector<BasicVector<T>> &queries) const {
+            return Batch<std::size_t>(queries, [this](const BasicVector<T> &v) {
+                return Nearest(v);
+            });
+        }
+
+        //! Пакетная версия WithinDistance, см. Nearest(queries)
+        std::vector<std::vector<std::size_t>> WithinDistance(
+                const std::vector<BasicVector<T>> &queries, RealType<T> distance) const {
+            return Batch<std::vector<std::size_t>>(
+                    queries, [this, distance](const BasicVector<T> &v) {
+                        return WithinDistance(v, distance);
+                    });
+        }
+
+        //! Пакетная версия Intersecting, см. Nearest(queries)
+        std::vector<std::vector<std::size_t>> Intersecting(
+                const std::vector<BasicSegment<T>> &queries) const {
+            return Batch<std::vector<std::size_t>>(
+                    queries, [this](const BasicSegment<T> &s) { return Intersecting(s); });
+        }
+
+    private:
+        struct Item {
+            detail::Box<T> box_;
+            std::size_t id_;
+        };
+
+        struct Node {
+            detail::Box<T> box_;
+            // Дети узла - nodes_[first_, first_ + count_), листа - segments_[first_, ...).
+            std::size_t first_;
+            std::size_t count_;
+            bool leaf_;
+        };
+
+        // Переставляет items так, что соседние группы по kNodeSize образуют узлы STR.
+        static void PackLevel(std::vector<Item> &items) {
+            std::size_t n = items.size();
+            std::size_t groups = (n + kNodeSize - 1) / kNodeSize;
+            std::size_t slices = static_cast<std::size_t>(
+                    std::ceil(std::sqrt(static_cast<double>(groups))));
+            std::size_t slice_size = slices * kNodeSize;
+            std::sort(items.begin(), items.end(), [](const Item &a, const Item &b) {
+                return a.box_.CenterX() < b.box_.CenterX();
+            });
+            auto by_y = [](const Item &a, const Item &b) {
+                return a.box_.CenterY() < b.box_.CenterY();
+            };
+            std::size_t count = (n + slice_size - 1) / slice_size;
+            detail::ParallelFor(0, count, 1, [&](std::size_t from, std::size_t to) {
+                for (std::size_t s = from; s < to; ++s) {
+                    std::sort(items.begin() + s * slice_size,
+                              items.begin() + std::min(n, (s + 1) * slice_size), by_y);
+                }
+            });
+        }
+
+        static Node MakeNode(const std::vector<Item> &items, std::size_t first, std::size_t last,
+                             bool leaf) {
+            Node node{items[first].box_, first, last - first, leaf};
+            for (std::size_t i = first + 1; i < last; ++i) {
+                node.box_.Extend(items[i].box_);
+            }
+            return node;
+        }
+
+        // Обход в глубину по узлам, прямоугольники которых принимает enter.
+        template <typename Enter, typename Report>
+        void Visit(const Enter &enter, const Report &report) const {
+            if (nodes_.empty()) {
+                return;
+            }
+            std::vector<std::size_t> stack;
+            if (enter(nodes_.back().box_)) {
+                stack.push_back(nodes_.size() - 1);
+            }
+            while (!stack.empty()) {
+                const Node &node = nodes_[stack.back()];
+                stack.pop_back();
+                for (std::size_t i = node.first_; i < node.first_ + node.count_; ++i) {
+                    if (node.leaf_) {
+                        report(i);
+                    } else if (enter(nodes_[i].box_)) {
+                        stack.push_back(i);
+                    }
+                }
+            }
+        }
+
+        static const BasicVector<T> &Anchor(const BasicVector<T> &v) {
+            return v;
+        }
+
+        static const BasicVector<T> &Anchor(const BasicSegment<T> &s) {
+            return s.a_;
+        }
+
+        template <typename Result, typename Query, typename Function>
+        std::vector<Result> Batch(const std::vector<Query> &queries,
+                                  const Function &function) const {
+            std::vector<Result> result(queries.size());
+            if (nodes_.empty()) {
+                return result;
+            }
+            // Квантуем точки запросов в сетку 2^16 x 2^16 над корнем.
+            const detail::Box<T> &root = nodes_.back().box_;
+            RealType<T> width = std::max<RealType<T>>(
+                    static_cast<RealType<T>>(root.max_x_) - root.min_x_, 1);
+            RealType<T> height = std::max<RealType<T>>(
+                    static_cast<RealType<T>>(root.max_y_) - root.min_y_, 1);
+            auto quantize = [](RealType<T> t) {
+                return static_cast<uint32_t>(std::clamp<RealType<T>>(t, 0, 1) * 65535);
+            };
+            std::vector<std::pair<uint32_t, std::size_t>> order(queries.size());
+            for (std::size_t i = 0; i < queries.size(); ++i) {
+                const BasicVector<T> &v = Anchor(queries[i]);
+                order[i] = {detail::MortonCode(quantize((v.x_ - root.min_x_) / width),
+                                               quantize((v.y_ - root.min_y_) / height)),
+                            i};
+            }
+            std::sort(order.begin(), order.end());
+            auto run = [&](std::size_t from, std::size_t to) {
+                for (std::size_t k = from; k < to; ++k) {
+                    result[order[k].second] = function(queries[order[k].second]);
+                }
+            };
+            detail::ParallelFor(0, order.size(), detail::kBvhGrain, run);
+            return result;
+        }
+
+        std::vector<Node> nodes_;
+        std::vector<BasicSegment<T>> segments_;
+        std::vector<std::size_t> ids_;
+    };
+
+    using SegmentBvh = BasicSegmentBvh<long double>;
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_SEGMENT_BVH_H
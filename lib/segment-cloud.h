@@ -0,0 +1,549 @@
+#ifndef OLYMP_GEOMETRY_SEGMENT_CLOUD_H
+#define OLYMP_GEOMETRY_SEGMENT_CLOUD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "simd.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Набор отрезков в виде структуры массивов: координаты концов a_ и b_ лежат в
+    четырёх отдельных выровненных массивах.
+    \tparam T Тип координат. Векторные ядра есть для double.
+    */
+    template <typename T>
+    class BasicSegmentCloud {
+    public:
+        BasicSegmentCloud() = default;
+
+        explicit BasicSegmentCloud(const std::vector<BasicSegment<T>> &segments) {
+            Reserve(segments.size());
+            for (const BasicSegment<T> &s : segments) {
+                PushBack(s);
+            }
+        }
+
+        std::size_t Size() const {
+            return ax_.size();
+        }
+
+        bool Empty() const {
+            return ax_.empty();
+        }
+
+        void Reserve(std::size_t size) {
+            ax_.reserve(size);
+            ay_.reserve(size);
+            bx_.reserve(size);
+            by_.reserve(size);
+        }
+
+        void Clear() {
+            ax_.clear();
+            ay_.clear();
+            bx_.clear();
+            by_.clear();
+        }
+
+        void PushBack(const BasicSegment<T> &s) {
+            ax_.push_back(s.a_.x_);
+            ay_.push_back(s.a_.y_);
+            bx_.push_back(s.b_.x_);
+            by_.push_back(s.b_.y_);
+        }
+
+        BasicSegment<T> operator[](std::size_t i) const {
+            return {{ax_[i], ay_[i]}, {bx_[i], by_[i]}};
+        }
+
+        const T *AX() const {
+            return ax_.data();
+        }
+
+        const T *AY() const {
+            return ay_.data();
+        }
+
+        const T *BX() const {
+            return bx_.data();
+        }
+
+        const T *BY() const {
+            return by_.data();
+        }
+
+    private:
+        std::vector<T, detail::AlignedAllocator<T>> ax_, ay_, bx_, by_;
+    };
+
+    using SegmentCloud = BasicSegmentCloud<double>;
+
+    namespace detail {
+        // Координаты первого (s1) и второго (s2) отрезков пары. Если kBroadcast, s1 один на
+        // все пары и массивы s1 состоят из одного элемента.
+        struct SegmentPairs {
+            const double *a1x, *a1y, *b1x, *b1y;
+            const double *a2x, *a2y, *b2x, *b2y;
+        };
+
+        // Результат ядра для группы пар: биты пересекающихся пар и биты пар, которые ядро не
+        // решает (вырожденный отрезок или общая прямая) и которые надо проверить через Intersect.
+        struct IntersectBits {
+            uint64_t result;
+            uint64_t special;
+        };
+
+#if OLYMP_GEOMETRY_X86_SIMD
+        // Ядра повторяют ветку общего положения Intersect операция в операцию и без FMA:
+        // ядра AVX2 и AVX-512 собираются с OLYMP_GEOMETRY_NO_FP_CONTRACT, иначе GCC сливает
+        // умножения и сложения в FMA сам. Поэтому для неособых пар ответ совпадает со
+        // скалярным побитово, если скалярный код тоже собран без такого слияния (GCC делает
+        // его по умолчанию при -mfma или -march=native, от этого спасает -ffp-contract=off).
+
+        template <bool kBroadcast>
+        OLYMP_GEOMETRY_TARGET_SSE2 inline __m128d LoadSse2(const double *p, std::size_t i) {
+            if constexpr (kBroadcast) {
+                return _mm_set1_pd(*p);
+            } else {
+                return _mm_loadu_pd(p + i);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline __m128d NearSse2(__m128d x, __m128d y, __m128d eps) {
+            const __m128d sign = _mm_set1_pd(-0.0);
+            return _mm_and_pd(_mm_cmplt_pd(_mm_andnot_pd(sign, x), eps),
+                              _mm_cmplt_pd(_mm_andnot_pd(sign, y), eps));
+        }
+
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline __m128d SameSideSse2(__m128d u, __m128d v, __m128d eps) {
+            const __m128d sign = _mm_set1_pd(-0.0), zero = _mm_setzero_pd();
+            __m128d off = _mm_and_pd(_mm_cmpge_pd(_mm_andnot_pd(sign, u), eps),
+                                     _mm_cmpge_pd(_mm_andnot_pd(sign, v), eps));
+            __m128d same = _mm_or_pd(_mm_and_pd(_mm_cmplt_pd(u, zero), _mm_cmplt_pd(v, zero)),
+                                     _mm_and_pd(_mm_cmpgt_pd(u, zero), _mm_cmpgt_pd(v, zero)));
+            return _mm_and_pd(off, same);
+        }
+
+        OLYMP_GEOMETRY_TARGET_SSE2
+        inline __m128d SideValueSse2(__m128d a, __m128d b, __m128d c, __m128d x, __m128d y) {
+            return _mm_add_pd(_mm_add_pd(_mm_mul_pd(a, x), _mm_mul_pd(b, y)), c);
+        }
+
+        template <bool kBroadcast>
+        OLYMP_GEOMETRY_TARGET_SSE2 inline IntersectBits IntersectSse2(const SegmentPairs &p,
+                                                                      std::size_t begin,
+                                                                      std::size_t count,
+                                                                      double eps) {
+            const __m128d veps = _mm_set1_pd(eps), sign = _mm_set1_pd(-0.0);
+            IntersectBits bits = {0, 0};
+            for (std::size_t k = 0; k + 2 <= count; k += 2) {
+                std::size_t i = begin + k;
+                __m128d a1x = LoadSse2<kBroadcast>(p.a1x, i), a1y = LoadSse2<kBroadcast>(p.a1y, i);
+                __m128d b1x = LoadSse2<kBroadcast>(p.b1x, i), b1y = LoadSse2<kBroadcast>(p.b1y, i);
+                __m128d a2x = _mm_loadu_pd(p.a2x + i), a2y = _mm_loadu_pd(p.a2y + i);
+                __m128d b2x = _mm_loadu_pd(p.b2x + i), b2y = _mm_loadu_pd(p.b2y + i);
+
+                __m128d endpoint = _mm_or_pd(
+                        _mm_or_pd(NearSse2(_mm_sub_pd(a2x, a1x), _mm_sub_pd(a2y, a1y), veps),
+                                  NearSse2(_mm_sub_pd(b2x, a1x), _mm_sub_pd(b2y, a1y), veps)),
+                        _mm_or_pd(NearSse2(_mm_sub_pd(a2x, b1x), _mm_sub_pd(a2y, b1y), veps),
+                                  NearSse2(_mm_sub_pd(b2x, b1x), _mm_sub_pd(b2y, b1y), veps)));
+                __m128d degenerate =
+                        _mm_or_pd(NearSse2(_mm_sub_pd(b1x, a1x), _mm_sub_pd(b1y, a1y), veps),
+                                  NearSse2(_mm_sub_pd(b2x, a2x), _mm_sub_pd(b2y, a2y), veps));
+
+                __m128d l1a = _mm_sub_pd(b1y, a1y), l1b = _mm_sub_pd(a1x, b1x);
+                __m128d l1c = _mm_xor_pd(
+                        sign, _mm_add_pd(_mm_mul_pd(l1a, a1x), _mm_mul_pd(l1b, a1y)));
+                __m128d l2a = _mm_sub_pd(b2y, a2y), l2b = _mm_sub_pd(a2x, b2x);
+                __m128d l2c = _mm_xor_pd(
+                        sign, _mm_add_pd(_mm_mul_pd(l2a, a2x), _mm_mul_pd(l2b, a2y)));
+                __m128d same_line =
+                        NearSse2(_mm_sub_pd(_mm_mul_pd(l1a, l2b), _mm_mul_pd(l2a, l1b)),
+                                 _mm_sub_pd(_mm_mul_pd(l1b, l2c), _mm_mul_pd(l2b, l1c)), veps);
+
+                __m128d alpha1 = SideValueSse2(l1a, l1b, l1c, a2x, a2y);
+                __m128d alpha2 = SideValueSse2(l1a, l1b, l1c, b2x, b2y);
+                __m128d beta1 = SideValueSse2(l2a, l2b, l2c, a1x, a1y);
+                __m128d beta2 = SideValueSse2(l2a, l2b, l2c, b1x, b1y);
+                __m128d apart = _mm_or_pd(SameSideSse2(alpha1, alpha2, veps),
+                                          SameSideSse2(beta1, beta2, veps));
+
+                __m128d special = _mm_andnot_pd(endpoint, _mm_or_pd(degenerate, same_line));
+                __m128d result = _mm_or_pd(endpoint, _mm_andnot_pd(_mm_or_pd(special, apart),
+                                                                   _mm_cmpeq_pd(veps, veps)));
+                bits.result |= static_cast<uint64_t>(_mm_movemask_pd(result)) << k;
+                bits.special |= static_cast<uint64_t>(_mm_movemask_pd(special)) << k;
+            }
+            return bits;
+        }
+
+        template <bool kBroadcast>
+        OLYMP_GEOMETRY_TARGET_AVX2 inline __m256d LoadAvx2(const double *p, std::size_t i) {
+            if constexpr (kBroadcast) {
+                return _mm256_set1_pd(*p);
+            } else {
+                return _mm256_loadu_pd(p + i);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline __m256d NearAvx2(__m256d x, __m256d y, __m256d eps) {
+            const __m256d sign = _mm256_set1_pd(-0.0);
+            return _mm256_and_pd(_mm256_cmp_pd(_mm256_andnot_pd(sign, x), eps, _CMP_LT_OQ),
+                                 _mm256_cmp_pd(_mm256_andnot_pd(sign, y), eps, _CMP_LT_OQ));
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline __m256d SameSideAvx2(__m256d u, __m256d v, __m256d eps) {
+            const __m256d sign = _mm256_set1_pd(-0.0), zero = _mm256_setzero_pd();
+            __m256d off = _mm256_and_pd(_mm256_cmp_pd(_mm256_andnot_pd(sign, u), eps, _CMP_GE_OQ),
+                                        _mm256_cmp_pd(_mm256_andnot_pd(sign, v), eps, _CMP_GE_OQ));
+            __m256d same = _mm256_or_pd(_mm256_and_pd(_mm256_cmp_pd(u, zero, _CMP_LT_OQ),
+                                                      _mm256_cmp_pd(v, zero, _CMP_LT_OQ)),
+                                        _mm256_and_pd(_mm256_cmp_pd(u, zero, _CMP_GT_OQ),
+                                                      _mm256_cmp_pd(v, zero, _CMP_GT_OQ)));
+            return _mm256_and_pd(off, same);
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX2 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline __m256d SideValueAvx2(__m256d a, __m256d b, __m256d c, __m256d x, __m256d y) {
+            return _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a, x), _mm256_mul_pd(b, y)), c);
+        }
+
+        template <bool kBroadcast>
+        OLYMP_GEOMETRY_TARGET_AVX2 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline IntersectBits IntersectAvx2(const SegmentPairs &p, std::size_t begin,
+                                           std::size_t count, double eps) {
+            const __m256d veps = _mm256_set1_pd(eps), sign = _mm256_set1_pd(-0.0);
+            IntersectBits bits = {0, 0};
+            for (std::size_t k = 0; k + 4 <= count; k += 4) {
+                std::size_t i = begin + k;
+                __m256d a1x = LoadAvx2<kBroadcast>(p.a1x, i), a1y = LoadAvx2<kBroadcast>(p.a1y, i);
+                __m256d b1x = LoadAvx2<kBroadcast>(p.b1x, i), b1y = LoadAvx2<kBroadcast>(p.b1y, i);
+                __m256d a2x = _mm256_loadu_pd(p.a2x + i), a2y = _mm256_loadu_pd(p.a2y + i);
+                __m256d b2x = _mm256_loadu_pd(p.b2x + i), b2y = _mm256_loadu_pd(p.b2y + i);
+
+                __m256d endpoint = _mm256_or_pd(
+                        _mm256_or_pd(
+                                NearAvx2(_mm256_sub_pd(a2x, a1x), _mm256_sub_pd(a2y, a1y), veps),
+                                NearAvx2(_mm256_sub_pd(b2x, a1x), _mm256_sub_pd(b2y, a1y), veps)),
+                        _mm256_or_pd(
+                                NearAvx2(_mm256_sub_pd(a2x, b1x), _mm256_sub_pd(a2y, b1y), veps),
+                                NearAvx2(_mm256_sub_pd(b2x, b1x), _mm256_sub_pd(b2y, b1y), veps)));
+                __m256d degenerate = _mm256_or_pd(
+                        NearAvx2(_mm256_sub_pd(b1x, a1x), _mm256_sub_pd(b1y, a1y), veps),
+                        NearAvx2(_mm256_sub_pd(b2x, a2x), _mm256_sub_pd(b2y, a2y), veps));
+
+                __m256d l1a = _mm256_sub_pd(b1y, a1y), l1b = _mm256_sub_pd(a1x, b1x);
+                __m256d l1c = _mm256_xor_pd(
+                        sign, _mm256_add_pd(_mm256_mul_pd(l1a, a1x), _mm256_mul_pd(l1b, a1y)));
+                __m256d l2a = _mm256_sub_pd(b2y, a2y), l2b = _mm256_sub_pd(a2x, b2x);
+                __m256d l2c = _mm256_xor_pd(
+                        sign, _mm256_add_pd(_mm256_mul_pd(l2a, a2x), _mm256_mul_pd(l2b, a2y)));
+                __m256d same_line = NearAvx2(
+                        _mm256_sub_pd(_mm256_mul_pd(l1a, l2b), _mm256_mul_pd(l2a, l1b)),
+                        _mm256_sub_pd(_mm256_mul_pd(l1b, l2c), _mm256_mul_pd(l2b, l1c)), veps);
+
+                __m256d apart = _mm256_or_pd(
+                        SameSideAvx2(SideValueAvx2(l1a, l1b, l1c, a2x, a2y),
+                                     SideValueAvx2(l1a, l1b, l1c, b2x, b2y), veps),
+                        SameSideAvx2(SideValueAvx2(l2a, l2b, l2c, a1x, a1y),
+                                     SideValueAvx2(l2a, l2b, l2c, b1x, b1y), veps));
+
+                __m256d special =
+                        _mm256_andnot_pd(endpoint, _mm256_or_pd(degenerate, same_line));
+                __m256d result = _mm256_or_pd(
+                        endpoint, _mm256_andnot_pd(_mm256_or_pd(special, apart),
+                                                   _mm256_cmp_pd(veps, veps, _CMP_EQ_OQ)));
+                bits.result |= static_cast<uint64_t>(_mm256_movemask_pd(result)) << k;
+                bits.special |= static_cast<uint64_t>(_mm256_movemask_pd(special)) << k;
+            }
+            return bits;
+        }
+
+        template <bool kBroadcast>
+        OLYMP_GEOMETRY_TARGET_AVX512 inline __m512d LoadAvx512(const double *p, std::size_t i) {
+            if constexpr (kBroadcast) {
+                return _mm512_set1_pd(*p);
+            } else {
+                return _mm512_loadu_pd(p + i);
+            }
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline __mmask8 NearAvx512(__m512d x, __m512d y, __m512d eps) {
+            return _mm512_cmp_pd_mask(_mm512_abs_pd(x), eps, _CMP_LT_OQ) &
+                   _mm512_cmp_pd_mask(_mm512_abs_pd(y), eps, _CMP_LT_OQ);
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline __mmask8 SameSideAvx512(__m512d u, __m512d v, __m512d eps) {
+            const __m512d zero = _mm512_setzero_pd();
+            __mmask8 off = _mm512_cmp_pd_mask(_mm512_abs_pd(u), eps, _CMP_GE_OQ) &
+                           _mm512_cmp_pd_mask(_mm512_abs_pd(v), eps, _CMP_GE_OQ);
+            __mmask8 same = (_mm512_cmp_pd_mask(u, zero, _CMP_LT_OQ) &
+                             _mm512_cmp_pd_mask(v, zero, _CMP_LT_OQ)) |
+                            (_mm512_cmp_pd_mask(u, zero, _CMP_GT_OQ) &
+                             _mm512_cmp_pd_mask(v, zero, _CMP_GT_OQ));
+            return off & same;
+        }
+
+        OLYMP_GEOMETRY_TARGET_AVX512 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline __m512d SideValueAvx512(__m512d a, __m512d b, __m512d c, __m512d x, __m512d y) {
+            return _mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(a, x), _mm512_mul_pd(b, y)), c);
+        }
+
+        template <bool kBroadcast>
+        OLYMP_GEOMETRY_TARGET_AVX512 OLYMP_GEOMETRY_NO_FP_CONTRACT
+        inline IntersectBits IntersectAvx512(const SegmentPairs &p, std::size_t begin,
+                                             std::size_t count, double eps) {
+            const __m512d veps = _mm512_set1_pd(eps);
+            IntersectBits bits = {0, 0};
+            for (std::size_t k = 0; k + 8 <= count; k += 8) {
+                std::size_t i = begin + k;
+                __m512d a1x = LoadAvx512<kBroadcast>(p.a1x, i);
+                __m512d a1y = LoadAvx512<kBroadcast>(p.a1y, i);
+                __m512d b1x = LoadAvx512<kBroadcast>(p.b1x, i);
+                __m512d b1y = LoadAvx512<kBroadcast>(p.b1y, i);
+                __m512d a2x = _mm512_loadu_pd(p.a2x + i), a2y = _mm512_loadu_pd(p.a2y + i);
+                __m512d b2x = _mm512_loadu_pd(p.b2x + i), b2y = _mm512_loadu_pd(p.b2y + i);
+
+                __mmask8 endpoint =
+                        NearAvx512(_mm512_sub_pd(a2x, a1x), _mm512_sub_pd(a2y, a1y), veps) |
+                        NearAvx512(_mm512_sub_pd(b2x, a1x), _mm512_sub_pd(b2y, a1y), veps) |
+                        NearAvx512(_mm512_sub_pd(a2x, b1x), _mm512_sub_pd(a2y, b1y), veps) |
+                        NearAvx512(_mm512_sub_pd(b2x, b1x), _mm512_sub_pd(b2y, b1y), veps);
+                __mmask8 degenerate =
+                        NearAvx512(_mm512_sub_pd(b1x, a1x), _mm512_sub_pd(b1y, a1y), veps) |
+                        NearAvx512(_mm512_sub_pd(b2x, a2x), _mm512_sub_pd(b2y, a2y), veps);
+
+                __m512d l1a = _mm512_sub_pd(b1y, a1y), l1b = _mm512_sub_pd(a1x, b1x);
+                __m512d l1c = _mm512_sub_pd(
+                        _mm512_set1_pd(-0.0),
+                        _mm512_add_pd(_mm512_mul_pd(l1a, a1x), _mm512_mul_pd(l1b, a1y)));
+                __m512d l2a = _mm512_sub_pd(b2y, a2y), l2b = _mm512_sub_pd(a2x, b2x);
+                __m512d l2c = _mm512_sub_pd(
+                        _mm512_set1_pd(-0.0),
+                        _mm512_add_pd(_mm512_mul_pd(l2a, a2x), _mm512_mul_pd(l2b, a2y)));
+                __mmask8 same_line = NearAvx512(
+                        _mm512_sub_pd(_mm512_mul_pd(l1a, l2b), _mm512_mul_pd(l2a, l1b)),
+                        _mm512_sub_pd(_mm512_mul_pd(l1b, l2c), _mm512_mul_pd(l2b, l1c)), veps);
+
+                __mmask8 apart =
+                        SameSideAvx512(SideValueAvx512(l1a, l1b, l1c, a2x, a2y),
+                                       SideValueAvx512(l1a, l1b, l1c, b2x, b2y), veps) |
+                        SameSideAvx512(SideValueAvx512(l2a, l2b, l2c, a1x, a1y),
+                                       SideValueAvx512(l2a, l2b, l2c, b1x, b1y), veps);
+
+                __mmask8 special = static_cast<__mmask8>(~endpoint & (degenerate | same_line));
+                __mmask8 result = static_cast<__mmask8>(endpoint | ~(special | apart));
+                bits.result |= static_cast<uint64_t>(result) << k;
+                bits.special |= static_cast<uint64_t>(special) << k;
+            }
+            return bits;
+        }
+
+        template <bool kBroadcast>
+        inline IntersectBits IntersectKernel(const SegmentPairs &p, std::size_t begin,
+                                             std::size_t count, double eps, std::size_t *done) {
+            switch (GetSimdLevel()) {
+                case SimdLevel::kAvx512:
+                    *done = count / 8 * 8;
+                    return IntersectAvx512<kBroadcast>(p, begin, count, eps);
+                case SimdLevel::kAvx2:
+                    *done = count / 4 * 4;
+                    return IntersectAvx2<kBroadcast>(p, begin, count, eps);
+                case SimdLevel::kSse2:
+                    *done = count / 2 * 2;
+                    return IntersectSse2<kBroadcast>(p, begin, count, eps);
+                case SimdLevel::kScalar:
+                    break;
+            }
+            *done = 0;
+            return {0, 0};
+        }
+#endif
+
+        // Проверяет пары [begin, begin + count), count <= 64, и возвращает маску пересекающихся.
+        // Пары, которые ядро не решило, и хвост меньше ширины регистра идут через Intersect.
+        template <bool kBroadcast, typename T>
+        uint64_t IntersectChunk(const BasicSegmentCloud<T> *first, const BasicSegment<T> &query,
+                                const BasicSegmentCloud<T> &second, std::size_t begin,
+                                std::size_t count) {
+            std::size_t done = 0;
+            IntersectBits bits = {0, 0};
+            // С точными предикатами Intersect не зависит от kEps, а ядра работают с полосой
+            // kEps, поэтому тогда все пары идут через Intersect.
+#if OLYMP_GEOMETRY_X86_SIMD && !defined(OLYMP_GEOMETRY_EXACT_PREDICATES)
+            if constexpr (std::is_same_v<T, double>) {
+                SegmentPairs p;
+                if constexpr (kBroadcast) {
+                    p = {&query.a_.x_, &query.a_.y_, &query.b_.x_, &query.b_.y_,
+                         second.AX(), second.AY(), second.BX(), second.BY()};
+                } else {
+                    p = {first->AX(), first->AY(), first->BX(), first->BY(),
+                         second.AX(), second.AY(), second.BX(), second.BY()};
+                }
+                bits = IntersectKernel<kBroadcast>(p, begin, count, kEpsOf<T>, &done);
+            }
+#endif
+            for (std::size_t k = 0; k < count; ++k) {
+                if (k >= done || ((bits.special >> k) & 1u)) {
+                    BasicSegment<T> s1 = query;
+                    if constexpr (!kBroadcast) {
+                        s1 = (*first)[begin + k];
+                    }
+                    if (Intersect(s1, second[begin + k])) {
+                        bits.result |= uint64_t{1} << k;
+                    } else {
+                        bits.result &= ~(uint64_t{1} << k);
+                    }
+                }
+            }
+            return bits.result;
+        }
+    }
+
+    /*!
+    \ingroup intersection
+    Проверяет пересечение отрезка segment с каждым отрезком набора, с тем же результатом,
+    что и Intersect(segment, segments[i]). Для double совпадение побитовое, только если
+    скалярный Intersect собран без слияния умножения и сложения в FMA: с -mfma или
+    -march=native GCC по умолчанию сливает их, и ответы у границы kEps могут разойтись,
+    поэтому такие сборки стоит делать с -ffp-contract=off. С OLYMP_GEOMETRY_EXACT_PREDICATES
+    ядра не используются и каждая пара проверяется точным Intersect.
+    \param[in] segment Отрезок
+    \param[in] segments Набор отрезков
+    \param[out] mask Битовая маска: бит i % 64 слова i / 64 равен Intersect(segment,
+    segments[i]). Должна вмещать (segments.Size() + 63) / 64 слов.
+    */
+    template <typename T>
+    void IntersectMask(const BasicSegment<T> &segment, const BasicSegmentCloud<T> &segments,
+                       uint64_t *mask) {
+        for (std::size_t begin = 0; begin < segments.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, segments.Size() - begin);
+            mask[begin / 64] =
+                    detail::IntersectChunk<true, T>(nullptr, segment, segments, begin, count);
+        }
+    }
+
+    /*!
+    \ingroup intersection
+    То же, что и IntersectMask(segment, segments, mask), но пишет ответ в массив bool.
+    \param[out] out out[i] = Intersect(segment, segments[i])
+    */
+    template <typename T>
+    void Intersect(const BasicSegment<T> &segment, const BasicSegmentCloud<T> &segments,
+                   bool *out) {
+        for (std::size_t begin = 0; begin < segments.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, segments.Size() - begin);
+            uint64_t bits =
+                    detail::IntersectChunk<true, T>(nullptr, segment, segments, begin, count);
+            for (std::size_t k = 0; k < count; ++k) {
+                out[begin + k] = (bits >> k) & 1u;
+            }
+        }
+    }
+
+    /*!
+    \ingroup intersection
+    Попарно проверяет пересечение first[i] и second[i]. Наборы должны быть одного размера.
+    \param[in] first Первые отрезки пар
+    \param[in] second Вторые отрезки пар
+    \param[out] mask Битовая маска, как в IntersectMask для одного отрезка
+    */
+    template <typename T>
+    void IntersectMask(const BasicSegmentCloud<T> &first, const BasicSegmentCloud<T> &second,
+                       uint64_t *mask) {
+        for (std::size_t begin = 0; begin < first.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, first.Size() - begin);
+            mask[begin / 64] =
+                    detail::IntersectChunk<false, T>(&first, {}, second, begin, count);
+        }
+    }
+
+    /*!
+    \ingroup intersection
+    То же, что и IntersectMask(first, second, mask), но пишет ответ в массив bool.
+    \param[out] out out[i] = Intersect(first[i], second[i])
+    */
+    template <typename T>
+    void Intersect(const BasicSegmentCloud<T> &first, const BasicSegmentCloud<T> &second,
+                   bool *out) {
+        for (std::size_t begin = 0; begin < first.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, first.Size() - begin);
+            uint64_t bits =
+                    detail::IntersectChunk<false, T>(&first, {}, second, begin, count);
+            for (std::size_t k = 0; k < count; ++k) {
+                out[begin + k] = (bits >> k) & 1u;
+            }
+        }
+    }
+
+    /*!
+    \ingroup intersection
+    Пересечения отрезка segment с каждым отрезком набора. Пары сначала отсеиваются тем же
+    ядром, что и в IntersectMask, по 64 за раз, и точки считаются только для
+    пересекающихся. Память не выделяется.
+    \param[in] segment Отрезок
+    \param[in] segments Набор отрезков
+    \param[out] out out[i] = Intersection(segment, segments[i]), массив размера segments.Size()
+    */
+    template <typename T>
+    void Intersection(const BasicSegment<T> &segment, const BasicSegmentCloud<T> &segments,
+                      IntersectionResult<T> *out) {
+        for (std::size_t begin = 0; begin < segments.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, segments.Size() - begin);
+            uint64_t bits =
+                    detail::IntersectChunk<true, T>(nullptr, segment, segments, begin, count);
+            for (std::size_t k = 0; k < count; ++k) {
+                out[begin + k] = (bits >> k) & 1u ? Intersection(segment, segments[begin + k])
+                                                  : IntersectionResult<T>();
+            }
+        }
+    }
+
+    /*!
+    \ingroup intersection
+    Попарные пересечения first[i] и second[i], как в Intersection(segment, segments, out).
+    Наборы должны быть одного размера.
+    \param[out] out out[i] = Intersection(first[i], second[i])
+    */
+    template <typename T>
+    void Intersection(const BasicSegmentCloud<T> &first, const BasicSegmentCloud<T> &second,
+                      IntersectionResult<T> *out) {
+        for (std::size_t begin = 0; begin < first.Size(); begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, first.Size() - begin);
+            uint64_t bits =
+                    detail::IntersectChunk<false, T>(&first, {}, second, begin, count);
+            for (std::size_t k = 0; k < count; ++k) {
+                std::size_t i = begin + k;
+                out[i] = (bits >> k) & 1u ? Intersection(first[i], second[i])
+                                          : IntersectionResult<T>();
+            }
+        }
+    }
+
+    /*!
+    \ingroup intersection
+    Пересечения прямой с каждым отрезком набора.
+    \param[in] line Прямая
+    \param[in] segments Набор отрезков
+    \param[out] out out[i] = Intersection(line, segments[i])
+    */
+    template <typename T>
+    void Intersection(const BasicLine<T> &line, const BasicSegmentCloud<T> &segments,
+                      IntersectionResult<T> *out) {
+        for (std::size_t i = 0; i < segments.Size(); ++i) {
+            out[i] = Intersection(line, segments[i]);
+        }
+    }
+}
+
+#endif //OLYMP_GEOMETRY_SEGMENT_CLOUD_H
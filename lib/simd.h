@@ -0,0 +1,126 @@
+#ifndef OLYMP_GEOMETRY_SIMD_H
+#define OLYMP_GEOMETRY_SIMD_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define OLYMP_GEOMETRY_X86_SIMD 1
+#include <immintrin.h>
+// Ядра компилируются под конкретный набор инструкций без -march, а выбираются во время
+// выполнения по GetSimdLevel().
+#define OLYMP_GEOMETRY_TARGET_SSE2 __attribute__((target("sse2")))
+#define OLYMP_GEOMETRY_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define OLYMP_GEOMETRY_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+// Ядра, которые должны совпадать со скалярным кодом до бита, собираются без слияния
+// умножения и сложения в FMA: GCC сливает даже отдельные _mm*_mul_pd и _mm*_add_pd.
+#if defined(__clang__)
+#define OLYMP_GEOMETRY_NO_FP_CONTRACT
+#else
+#define OLYMP_GEOMETRY_NO_FP_CONTRACT __attribute__((optimize("fp-contract=off")))
+#endif
+#else
+#define OLYMP_GEOMETRY_X86_SIMD 0
+#endif
+
+namespace olymp_geometry {
+    /*!
+    \defgroup simd Векторные инструкции
+    \brief Выбор набора SIMD-инструкций для пакетных функций.
+    */
+    ///@{
+
+    /*!
+    Наборы инструкций, под которые собраны пакетные ядра, по возрастанию ширины.
+    */
+    enum class SimdLevel {
+        kScalar,
+        kSse2,
+        kAvx2,
+        kAvx512
+    };
+
+    /*!
+    Определяет лучший набор инструкций, поддерживаемый процессором.
+    \return kScalar вне x86-64 или без поддержки компилятора
+    */
+    inline SimdLevel DetectSimdLevel() {
+#if OLYMP_GEOMETRY_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SimdLevel::kAvx512;
+        } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SimdLevel::kAvx2;
+        } else {
+            return SimdLevel::kSse2;
+        }
+#else
+        return SimdLevel::kScalar;
+#endif
+    }
+
+    namespace detail {
+        inline std::atomic<SimdLevel> &ActiveSimdLevel() {
+            static std::atomic<SimdLevel> level(DetectSimdLevel());
+            return level;
+        }
+    }
+
+    /*!
+    \return Набор инструкций, которым сейчас пользуются пакетные функции
+    */
+    inline SimdLevel GetSimdLevel() {
+        return detail::ActiveSimdLevel().load(std::memory_order_relaxed);
+    }
+
+    /*!
+    Ограничивает пакетные функции набором инструкций level, например для сравнения ядер
+    между собой. Уровень выше поддерживаемого процессором понижается до поддерживаемого.
+    \param[in] level Желаемый набор инструкций
+    */
+    inline void SetSimdLevel(SimdLevel level) {
+        detail::ActiveSimdLevel().store(std::min(level, DetectSimdLevel()),
+                                        std::memory_order_relaxed);
+    }
+    ///@}
+
+    namespace detail {
+        constexpr std::size_t kSimdAlignment = 64;
+
+        // Выравнивает массивы по строке кэша, чтобы загрузки AVX-512 не пересекали её границу.
+        template <typename T>
+        class AlignedAllocator {
+        public:
+            using value_type = T;
+
+            AlignedAllocator() = default;
+
+            template <typename U>
+            AlignedAllocator(const AlignedAllocator<U> &) {
+            }
+
+            T *allocate(std::size_t n) {
+                return static_cast<T *>(
+                        ::operator new(n * sizeof(T), std::align_val_t(kSimdAlignment)));
+            }
+
+            void deallocate(T *p, std::size_t) {
+                ::operator delete(p, std::align_val_t(kSimdAlignment));
+            }
+
+            template <typename U>
+            bool operator==(const AlignedAllocator<U> &) const {
+                return true;
+            }
+
+            template <typename U>
+            bool operator!=(const AlignedAllocator<U> &) const {
+                return false;
+            }
+        };
+    }
+}
+
+#endif //OLYMP_GEOMETRY_SIMD_H
@@ -0,0 +1,514 @@
+#ifndef OLYMP_GEOMETRY_SPATIAL_INDEX_H
+#define OLYMP_GEOMETRY_SPATIAL_INDEX_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "olymp-geometry.h"
+#include "parallel.h"
+
+namespace olymp_geometry {
+    namespace detail {
+        // Сколько запросов или точек обрабатывает один поток как минимум.
+        constexpr std::size_t kSpatialGrain = 1024;
+
+        template <typename T>
+        struct IndexedPoint {
+            BasicVector<T> point_;
+            std::size_t id_;
+        };
+
+        // k ближайших кандидатов в куче с самым дальним на вершине.
+        template <typename T>
+        class NearestHeap {
+        public:
+            explicit NearestHeap(std::size_t k) : k_(k) {
+                heap_.reserve(k);
+            }
+
+            // Квадрат расстояния, ближе которого должен быть новый кандидат.
+            RealType<T> Bound() const {
+                return heap_.size() < k_ ? std::numeric_limits<RealType<T>>::infinity()
+                                         : heap_.front().first;
+            }
+
+            void Push(RealType<T> distance, std::size_t id) {
+                if (heap_.size() < k_) {
+                    heap_.emplace_back(distance, id);
+                    std::push_heap(heap_.begin(), heap_.end());
+                } else if (distance < heap_.front().first) {
+                    std::pop_heap(heap_.begin(), heap_.end());
+                    heap_.back() = {distance, id};
+                    std::push_heap(heap_.begin(), heap_.end());
+                }
+            }
+
+            std::vector<std::size_t> Extract() {
+                std::sort_heap(heap_.begin(), heap_.end());
+                std::vector<std::size_t> ids(heap_.size());
+                for (std::size_t i = 0; i < heap_.size(); ++i) {
+                    ids[i] = heap_[i].second;
+                }
+                return ids;
+            }
+
+        private:
+            std::size_t k_;
+            std::vector<std::pair<RealType<T>, std::size_t>> heap_;
+        };
+
+        // result[i] = query(i) для i < count, запросы распределяются между потоками.
+        template <typename Result, typename Query>
+        std::vector<Result> BatchQuery(std::size_t count, const Query &query) {
+            std::vector<Result> result(count);
+            ParallelFor(0, count, kSpatialGrain, [&](std::size_t from, std::size_t to) {
+                for (std::size_t i = from; i < to; ++i) {
+                    result[i] = query(i);
+                }
+            });
+            return result;
+        }
+    }
+
+    /*!
+    \defgroup spatial_index Пространственные индексы
+    \brief Статические индексы над множеством точек для поиска ближайших соседей и точек в
+    круге. Точки хранятся в плоских массивах в порядке обхода индекса, а запросы возвращают
+    индексы точек во входном массиве. Построение и пакетные запросы выполняются в
+    GetThreadCount() потоков.
+    */
+    ///@{
+
+    /*!
+    \brief k-d дерево без указателей: узел - это отрезок массива, медиана которого по x или
+    по y (попеременно с глубиной) лежит в середине. Строится за O(n log n).
+    */
+    template <typename T>
+    class BasicKdTree {
+    public:
+        BasicKdTree() = default;
+
+        explicit BasicKdTree(const std::vector<BasicVector<T>> &points) {
+            std::size_t n = points.size();
+            std::vector<detail::IndexedPoint<T>> entries(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                entries[i] = {points[i], i};
+            }
+            Build(entries, 0, n, 0, detail::ParallelDepth());
+            points_.resize(n);
+            ids_.resize(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                points_[i] = entries[i].point_;
+                ids_[i] = entries[i].id_;
+            }
+        }
+
+        std::size_t Size() const {
+            return points_.size();
+        }
+
+        /*!
+        \param[in] v Точка запроса
+        \return Индекс ближайшей к v точки. Дерево не должно быть пустым
+        */
+        std::size_t Nearest(const BasicVector<T> &v) const {
+            RealType<T> best = std::numeric_limits<RealType<T>>::infinity();
+            std::size_t best_position = 0;
+            SearchNearest(0, points_.size(), 0, v, best, best_position);
+            return ids_[best_position];
+        }
+
+        /*!
+        \param[in] v Точка запроса
+        \param[in] k Число соседей
+        \return Индексы min(k, Size()) ближайших к v точек по возрастанию расстояния
+        */
+        std::vector<std::size_t> KNearest(const BasicVector<T> &v, std::size_t k) const {
+            detail::NearestHeap<T> heap(std::min(k, points_.size()));
+            if (k != 0) {
+                SearchKNearest(0, points_.size(), 0, v, heap);
+            }
+            return heap.Extract();
+        }
+
+        /*!
+        \param[in] v Центр круга
+        \param[in] radius Радиус
+        \return Индексы точек на расстоянии не больше radius от v по возрастанию индекса
+        */
+        std::vector<std::size_t> Radius(const BasicVector<T> &v, RealType<T> radius) const {
+            std::vector<std::size_t> result;
+            SearchRadius(0, points_.size(), 0, v, radius, result);
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        //! Nearest для каждого запроса
+        std::vector<std::size_t> Nearest(const std::vector<BasicVector<T>> &queries) const {
+            return detail::BatchQuery<std::size_t>(
+                    queries.size(), [&](std::size_t i) { return Nearest(queries[i]); });
+        }
+
+        //! KNearest для каждого запроса
+        std::vector<std::vector<std::size_t>> KNearest(
+                const std::vector<BasicVector<T>> &queries, std::size_t k) const {
+            return detail::BatchQuery<std::vector<std::size_t>>(
+                    queries.size(), [&](std::size_t i) { return KNearest(queries[i], k); });
+        }
+
+        //! Radius для каждого запроса
+        std::vector<std::vector<std::size_t>> Radius(const std::vector<BasicVector<T>> &queries,
+                                                     RealType<T> radius) const {
+            return detail::BatchQuery<std::vector<std::size_t>>(
+                    queries.size(), [&](std::size_t i) { return Radius(queries[i], radius); });
+        }
+
+    private:
+        // Узлы меньше этого размера не делятся и просматриваются целиком.
+        static constexpr std::size_t kLeafSize = 8;
+        // Поддеревья меньше этого размера строятся в том же потоке.
+        static constexpr std::size_t kParallelBuildSize = 1 << 14;
+
+        static RealType<T> Coordinate(const BasicVector<T> &v, int axis) {
+            return static_cast<RealType<T>>(axis == 0 ? v.x_ : v.y_);
+        }
+
+        static void Build(std::vector<detail::IndexedPoint<T>> &entries, std::size_t low,
+                          std::size_t high, int depth, int spawn) {
+            if (high - low <= kLeafSize) {
+                return;
+            }
+            std::size_t middle = low + (high - low) / 2;
+            int axis = depth & 1;
+            std::nth_element(entries.begin() + low, entries.begin() + middle,
+                             entries.begin() + high, [axis](const auto &a, const auto &b) {
+                                 return axis == 0 ? a.point_.x_ < b.point_.x_
+                                                  : a.point_.y_ < b.point_.y_;
+                             });
+            detail::ParallelInvoke(
+                    spawn > 0 && high - low >= kParallelBuildSize,
+                    [&] { Build(entries, low, middle, depth + 1, spawn - 1); },
+                    [&] { Build(entries, middle + 1, high, depth + 1, spawn - 1); });
+        }
+
+        void SearchNearest(std::size_t low, std::size_t high, int depth, const BasicVector<T> &v,
+                           RealType<T> &best, std::size_t &best_position) const {
+            if (high - low <= kLeafSize) {
+                for (std::size_t i = low; i < high; ++i) {
+                    RealType<T> d = DistSquared(points_[i], v);
+                    if (d < best) {
+                        best = d;
+                        best_position = i;
+                    }
+                }
+                return;
+            }
+            std::size_t middle = low + (high - low) / 2;
+            RealType<T> d = DistSquared(points_[middle], v);
+            if (d < best) {
+                best = d;
+                best_position = middle;
+            }
+            RealType<T> diff = Coordinate(v, depth & 1) - Coordinate(points_[middle], depth & 1);
+            if (diff < 0) {
+                SearchNearest(low, middle, depth + 1, v, best, best_position);
+                if (diff * diff < best) {
+                    SearchNearest(middle + 1, high, depth + 1, v, best, best_position);
+                }
+            } else {
+                SearchNearest(middle + 1, high, depth + 1, v, best, best_position);
+                if (diff * diff < best) {
+                    SearchNearest(low, middle, depth + 1, v, best, best_position);
+                }
+            }
+        }
+
+        void SearchKNearest(std::size_t low, std::size_t high, int depth,
+                            const BasicVector<T> &v, detail::NearestHeap<T> &heap) const {
+            if (high - low <= kLeafSize) {
+                for (std::size_t i = low; i < high; ++i) {
+                    heap.Push(DistSquared(points_[i], v), ids_[i]);
+                }
+                return;
+            }
+            std::size_t middle = low + (high - low) / 2;
+            heap.Push(DistSquared(points_[middle], v), ids_[middle]);
+            RealType<T> diff = Coordinate(v, depth & 1) - Coordinate(points_[middle], depth & 1);
+            if (diff < 0) {
+                SearchKNearest(low, middle, depth + 1, v, heap);
+                if (diff * diff < heap.Bound()) {
+                    SearchKNearest(middle + 1, high, depth + 1, v, heap);
+                }
+            } else {
+                SearchKNearest(middle + 1, high, depth + 1, v, heap);
+                if (diff * diff < heap.Bound()) {
+                    SearchKNearest(low, middle, depth + 1, v, heap);
+                }
+            }
+        }
+
+        void SearchRadius(std::size_t low, std::size_t high, int depth, const BasicVector<T> &v,
+                          RealType<T> radius, std::vector<std::size_t> &result) const {
+            if (high - low <= kLeafSize) {
+                for (std::size_t i = low; i < high; ++i) {
+                    if (DistSquared(points_[i], v) <= radius * radius) {
+                        result.push_back(ids_[i]);
+                    }
+                }
+                return;
+            }
+            std::size_t middle = low + (high - low) / 2;
+            if (DistSquared(points_[middle], v) <= radius * radius) {
+                result.push_back(ids_[middle]);
+            }
+            RealType<T> diff = Coordinate(v, depth & 1) - Coordinate(points_[middle], depth & 1);
+            if (diff <= radius) {
+                SearchRadius(low, middle, depth + 1, v, radius, result);
+            }
+            if (diff >= -radius) {
+                SearchRadius(middle + 1, high, depth + 1, v, radius, result);
+            }
+        }
+
+        std::vector<BasicVector<T>> points_;
+        std::vector<std::size_t> ids_;
+    };
+
+    /*!
+    \brief Равномерная сетка над ограничивающим прямоугольником точек. Точки отсортированы
+    по клеткам (сортировка подсчётом за O(n)), клетка - это отрезок общего массива.
+    Хорошо подходит для равномерно распределённых точек и запросов с небольшим радиусом.
+    */
+    template <typename T>
+    class BasicUniformGrid {
+    public:
+        BasicUniformGrid() : cell_start_(2, 0) {
+        }
+
+        /*!
+        \param[in] points Точки
+        \param[in] cell_size Сторона клетки. По умолчанию выбирается так, чтобы в клетке в
+        среднем было около двух точек
+        */
+        explicit BasicUniformGrid(const std::vector<BasicVector<T>> &points,
+                                  RealType<T> cell_size = 0) {
+            std::size_t n = points.size();
+            RealType<T> max_x = 0, max_y = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                RealType<T> x = static_cast<RealType<T>>(points[i].x_);
+                RealType<T> y = static_cast<RealType<T>>(points[i].y_);
+                min_x_ = i == 0 ? x : std::min(min_x_, x);
+                min_y_ = i == 0 ? y : std::min(min_y_, y);
+                max_x = i == 0 ? x : std::max(max_x, x);
+                max_y = i == 0 ? y : std::max(max_y, y);
+            }
+            RealType<T> width = max_x - min_x_, height = max_y - min_y_;
+            cell_ = cell_size;
+            if (!(cell_ > 0) && n > 0) {
+                cell_ = std::sqrt(2 * width * height / static_cast<RealType<T>>(n));
+                if (!(cell_ > 0)) {
+                    // Все точки на одной горизонтали или вертикали.
+                    cell_ = 2 * std::max(width, height) / static_cast<RealType<T>>(n);
+                }
+            }
+            if (!(cell_ > 0)) {
+                cell_ = 1;
+            }
+            // Не больше 4n клеток, сколько бы ни запросили.
+            RealType<T> max_cells = 4 * static_cast<RealType<T>>(n) + 16;
+            while ((width / cell_ + 1) * (height / cell_ + 1) > max_cells) {
+                cell_ *= 2;
+            }
+            columns_ = static_cast<std::size_t>(width / cell_) + 1;
+            rows_ = static_cast<std::size_t>(height / cell_) + 1;
+
+            std::vector<std::size_t> cells(n);
+            detail::ParallelFor(0, n, detail::kSpatialGrain, [&](std::size_t from, std::size_t to) {
+                for (std::size_t i = from; i < to; ++i) {
+                    cells[i] = Row(points[i].y_) * columns_ + Column(points[i].x_);
+                }
+            });
+            cell_start_.assign(columns_ * rows_ + 1, 0);
+            for (std::size_t cell : cells) {
+                ++cell_start_[cell + 1];
+            }
+            for (std::size_t c = 0; c + 1 < cell_start_.size(); ++c) {
+                cell_start_[c + 1] += cell_start_[c];
+            }
+            points_.resize(n);
+            ids_.resize(n);
+            std::vector<std::size_t> position(cell_start_.begin(), cell_start_.end() - 1);
+            for (std::size_t i = 0; i < n; ++i) {
+                std::size_t to = position[cells[i]]++;
+                points_[to] = points[i];
+                ids_[to] = i;
+            }
+        }
+
+        std::size_t Size() const {
+            return points_.size();
+        }
+
+        RealType<T> CellSize() const {
+            return cell_;
+        }
+
+        //! См. BasicKdTree::Nearest
+        std::size_t Nearest(const BasicVector<T> &v) const {
+            std::vector<std::size_t> nearest = KNearest(v, 1);
+            return nearest.empty() ? 0 : nearest[0];
+        }
+
+        //! См. BasicKdTree::KNearest
+        std::vector<std::size_t> KNearest(const BasicVector<T> &v, std::size_t k) const {
+            detail::NearestHeap<T> heap(std::min(k, points_.size()));
+            if (k == 0 || points_.empty()) {
+                return heap.Extract();
+            }
+            // Обходим клетки кольцами вокруг клетки запроса, пока непросмотренная часть сетки
+            // не окажется дальше k-го кандидата.
+            int64_t column = static_cast<int64_t>(Column(v.x_));
+            int64_t row = static_cast<int64_t>(Row(v.y_));
+            int64_t columns = static_cast<int64_t>(columns_), rows = static_cast<int64_t>(rows_);
+            RealType<T> x = static_cast<RealType<T>>(v.x_), y = static_cast<RealType<T>>(v.y_);
+            for (int64_t ring = 0;; ++ring) {
+                auto visit = [&](int64_t c, int64_t r) {
+                    std::size_t cell = static_cast<std::size_t>(r) * columns_ +
+                                       static_cast<std::size_t>(c);
+                    for (std::size_t i = cell_start_[cell]; i < cell_start_[cell + 1]; ++i) {
+                        heap.Push(DistSquared(points_[i], v), ids_[i]);
+                    }
+                };
+                int64_t left = column - ring, right = column + ring;
+                int64_t bottom = row - ring, top = row + ring;
+                for (int64_t c = std::max<int64_t>(left, 0); c <= std::min(right, columns - 1);
+                     ++c) {
+                    if (bottom >= 0) {
+                        visit(c, bottom);
+                    }
+                    if (ring > 0 && top < rows) {
+                        visit(c, top);
+                    }
+                }
+                for (int64_t r = std::max<int64_t>(bottom + 1, 0); r <= std::min(top - 1, rows - 1);
+                     ++r) {
+                    if (ring > 0 && left >= 0) {
+                        visit(left, r);
+                    }
+                    if (ring > 0 && right < columns) {
+                        visit(right, r);
+                    }
+                }
+
+                // Расстояние от запроса до ещё не просмотренных клеток.
+                auto x_edge = [this](int64_t c) {
+                    return min_x_ + static_cast<RealType<T>>(c) * cell_;
+                };
+                auto y_edge = [this](int64_t r) {
+                    return min_y_ + static_cast<RealType<T>>(r) * cell_;
+                };
+                RealType<T> bound = std::numeric_limits<RealType<T>>::infinity();
+                if (left > 0) {
+                    bound = std::min(bound, x - x_edge(left));
+                }
+                if (right + 1 < columns) {
+                    bound = std::min(bound, x_edge(right + 1) - x);
+                }
+                if (bottom > 0) {
+                    bound = std::min(bound, y - y_edge(bottom));
+                }
+                if (top + 1 < rows) {
+                    bound = std::min(bound, y_edge(top + 1) - y);
+                }
+                if (bound == std::numeric_limits<RealType<T>>::infinity()) {
+                    break;
+                }
+                bound = std::max<RealType<T>>(bound, 0);
+                if (heap.Bound() <= bound * bound) {
+                    break;
+                }
+            }
+            return heap.Extract();
+        }
+
+        //! См. BasicKdTree::Radius
+        std::vector<std::size_t> Radius(const BasicVector<T> &v, RealType<T> radius) const {
+            std::vector<std::size_t> result;
+            if (points_.empty()) {
+                return result;
+            }
+            RealType<T> x = static_cast<RealType<T>>(v.x_), y = static_cast<RealType<T>>(v.y_);
+            std::size_t first_column = Column(x - radius), last_column = Column(x + radius);
+            std::size_t first_row = Row(y - radius), last_row = Row(y + radius);
+            for (std::size_t r = first_row; r <= last_row; ++r) {
+                std::size_t from = cell_start_[r * columns_ + first_column];
+                std::size_t to = cell_start_[r * columns_ + last_column + 1];
+                // Клетки одной строки идут в массиве подряд.
+                for (std::size_t i = from; i < to; ++i) {
+                    if (DistSquared(points_[i], v) <= radius * radius) {
+                        result.push_back(ids_[i]);
+                    }
+                }
+            }
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        //! Nearest для каждого запроса
+        std::vector<std::size_t> Nearest(const std::vector<BasicVector<T>> &queries) const {
+            return detail::BatchQuery<std::size_t>(
+                    queries.size(), [&](std::size_t i) { return Nearest(queries[i]); });
+        }
+
+        //! KNearest для каждого запроса
+        std::vector<std::vector<std::size_t>> KNearest(
+                const std::vector<BasicVector<T>> &queries, std::size_t k) const {
+            return detail::BatchQuery<std::vector<std::size_t>>(
+                    queries.size(), [&](std::size_t i) { return KNearest(queries[i], k); });
+        }
+
+        //! Radius для каждого запроса
+        std::vector<std::vector<std::size_t>> Radius(const std::vector<BasicVector<T>> &queries,
+                                                     RealType<T> radius) const {
+            return detail::BatchQuery<std::vector<std::size_t>>(
+                    queries.size(), [&](std::size_t i) { return Radius(queries[i], radius); });
+        }
+
+    private:
+        // Номер клетки по координате, прижатый к границам сетки.
+        static std::size_t Cell(RealType<T> offset, RealType<T> cell, std::size_t count) {
+            RealType<T> index = std::floor(offset / cell);
+            if (!(index > 0)) {
+                return 0;
+            }
+            return index >= static_cast<RealType<T>>(count - 1) ? count - 1
+                                                                : static_cast<std::size_t>(index);
+        }
+
+        std::size_t Column(RealType<T> x) const {
+            return Cell(x - min_x_, cell_, columns_);
+        }
+
+        std::size_t Row(RealType<T> y) const {
+            return Cell(y - min_y_, cell_, rows_);
+        }
+
+        RealType<T> min_x_ = 0, min_y_ = 0, cell_ = 1;
+        std::size_t columns_ = 1, rows_ = 1;
+        std::vector<std::size_t> cell_start_;
+        std::vector<BasicVector<T>> points_;
+        std::vector<std::size_t> ids_;
+    };
+
+    using KdTree = BasicKdTree<long double>;
+
+    using UniformGrid = BasicUniformGrid<long double>;
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_SPATIAL_INDEX_H
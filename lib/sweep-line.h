@@ -0,0 +1,336 @@
+#ifndef OLYMP_GEOMETRY_SWEEP_LINE_H
+#define OLYMP_GEOMETRY_SWEEP_LINE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "olymp-geometry.h"
+
+namespace olymp_geometry {
+    /*!
+    \brief Пересекающаяся пара отрезков, найденная заметающей прямой.
+    */
+    template <typename T>
+    struct SegmentIntersection {
+        //! Индексы отрезков во входном массиве, first_ < second_
+        std::size_t first_, second_;
+        //! Общая точка. Для наложившихся отрезков - самая левая (нижняя) точка наложения
+        BasicVector<RealType<T>> point_;
+    };
+
+    namespace detail {
+        // Точки событий вещественные даже для целых координат, поэтому все сравнения здесь
+        // идут с точностью kEpsOf<RealType<T>>.
+
+        // Отрезок, концы которого упорядочены по x, а при равных x - по y.
+        template <typename T>
+        struct SweepSegment {
+            BasicVector<RealType<T>> p_, q_;
+
+            bool IsVertical() const {
+                return detail::Abs(q_.x_ - p_.x_) < kEpsOf<RealType<T>>;
+            }
+
+            RealType<T> YAt(RealType<T> x) const {
+                if (IsVertical()) {
+                    return p_.y_;
+                }
+                return p_.y_ + (q_.y_ - p_.y_) * (x - p_.x_) / (q_.x_ - p_.x_);
+            }
+
+            RealType<T> Slope() const {
+                if (IsVertical()) {
+                    return std::numeric_limits<RealType<T>>::infinity();
+                }
+                return (q_.y_ - p_.y_) / (q_.x_ - p_.x_);
+            }
+        };
+
+        template <typename T>
+        std::vector<SweepSegment<T>> MakeSweepSegments(
+                const std::vector<BasicSegment<T>> &segments) {
+            std::vector<SweepSegment<T>> result;
+            result.reserve(segments.size());
+            for (const BasicSegment<T> &s : segments) {
+                BasicVector<RealType<T>> a(s.a_), b(s.b_);
+                if (b.x_ < a.x_ - kEpsOf<RealType<T>> ||
+                    (detail::Abs(b.x_ - a.x_) < kEpsOf<RealType<T>> && b.y_ < a.y_)) {
+                    std::swap(a, b);
+                }
+                result.push_back({a, b});
+            }
+            return result;
+        }
+
+        // Порядок событий: слева направо, при равных x - снизу вверх.
+        template <typename T>
+        struct EventLess {
+            bool operator()(const BasicVector<RealType<T>> &a,
+                            const BasicVector<RealType<T>> &b) const {
+                if (detail::Abs(a.x_ - b.x_) >= kEpsOf<RealType<T>>) {
+                    return a.x_ < b.x_;
+                }
+                return a.y_ < b.y_ - kEpsOf<RealType<T>>;
+            }
+        };
+
+        // Порядок отрезков на заметающей прямой сразу после точки события sweep_: по высоте,
+        // а у проходящих через одну точку - по наклону. Вертикальный отрезок считается
+        // находящимся на высоте события.
+        template <typename T>
+        class StatusLess {
+        public:
+            using is_transparent = void;
+
+            StatusLess(const std::vector<SweepSegment<T>> *segments,
+                       const BasicVector<RealType<T>> *sweep)
+                : segments_(segments), sweep_(sweep) {
+            }
+
+            RealType<T> Height(std::size_t i) const {
+                const SweepSegment<T> &s = (*segments_)[i];
+                if (s.IsVertical()) {
+                    return std::clamp(sweep_->y_, s.p_.y_, s.q_.y_);
+                }
+                return s.YAt(sweep_->x_);
+            }
+
+            bool operator()(std::size_t a, std::size_t b) const {
+                RealType<T> ya = Height(a), yb = Height(b);
+                if (detail::Abs(ya - yb) >= kEpsOf<RealType<T>>) {
+                    return ya < yb;
+                }
+                RealType<T> sa = (*segments_)[a].Slope(), sb = (*segments_)[b].Slope();
+                if (sa < sb - kEpsOf<RealType<T>> || sb < sa - kEpsOf<RealType<T>>) {
+                    return sa < sb;
+                }
+                return a < b;
+            }
+
+            // Сравнение с высотой: отрезки, проходящие через неё, эквивалентны ей.
+            bool operator()(std::size_t a, RealType<T> y) const {
+                return Height(a) <= y - kEpsOf<RealType<T>>;
+            }
+
+            bool operator()(RealType<T> y, std::size_t b) const {
+                return Height(b) >= y + kEpsOf<RealType<T>>;
+            }
+
+        private:
+            const std::vector<SweepSegment<T>> *segments_;
+            const BasicVector<RealType<T>> *sweep_;
+        };
+    }
+
+    /*!
+    \defgroup sweep_line Заметающая прямая
+    \ingroup intersection
+    \brief Поиск пересечений во множестве отрезков за O(n log n) и O((n + k) log n).
+    */
+    ///@{
+
+    /*!
+    Алгоритм Шамоса-Хоя: проверяет, есть ли среди отрезков хотя бы одна пересекающаяся
+    пара, за O(n log n). Пересечение проверяется через Intersect, так что касания,
+    вертикальные и наложившиеся отрезки учитываются так же, как в Intersect.
+    \param[in] segments Отрезки
+    \return Индексы какой-нибудь пересекающейся пары или std::nullopt
+    */
+    template <typename T>
+    std::optional<std::pair<std::size_t, std::size_t>> FindAnyIntersection(
+            const std::vector<BasicSegment<T>> &segments) {
+        std::vector<detail::SweepSegment<T>> sweep = detail::MakeSweepSegments(segments);
+        // Отрезки, которые одновременно лежат на заметающей прямой, сравниваются по высоте
+        // в точке x, где начинается более поздний из них. Пока пересечений нет, этот
+        // порядок не меняется.
+        auto less = [&sweep](std::size_t a, std::size_t b) {
+            RealType<T> x = std::max(sweep[a].p_.x_, sweep[b].p_.x_);
+            return sweep[a].YAt(x) < sweep[b].YAt(x) - kEpsOf<RealType<T>>;
+        };
+        std::multiset<std::size_t, decltype(less)> status(less);
+        std::vector<typename std::multiset<std::size_t, decltype(less)>::iterator> where(
+                segments.size());
+
+        // (x, 0 - начало или 1 - конец, индекс): в одной точке сначала вставка, потом удаление.
+        std::vector<std::pair<RealType<T>, std::pair<int, std::size_t>>> events;
+        events.reserve(2 * segments.size());
+        for (std::size_t i = 0; i < segments.size(); ++i) {
+            events.push_back({sweep[i].p_.x_, {0, i}});
+            events.push_back({sweep[i].q_.x_, {1, i}});
+        }
+        std::sort(events.begin(), events.end(), [](const auto &a, const auto &b) {
+            if (detail::Abs(a.first - b.first) >= kEpsOf<RealType<T>>) {
+                return a.first < b.first;
+            }
+            return a.second < b.second;
+        });
+
+        auto check = [&segments](std::size_t a, std::size_t b) {
+            return Intersect(segments[a], segments[b]);
+        };
+        for (const auto &event : events) {
+            std::size_t id = event.second.second;
+            if (event.second.first == 0) {
+                auto next = status.lower_bound(id);
+                if (next != status.end() && check(*next, id)) {
+                    return std::make_pair(std::min(*next, id), std::max(*next, id));
+                }
+                if (next != status.begin() && check(*std::prev(next), id)) {
+                    std::size_t other = *std::prev(next);
+                    return std::make_pair(std::min(other, id), std::max(other, id));
+                }
+                where[id] = status.insert(next, id);
+            } else {
+                auto next = std::next(where[id]);
+                if (next != status.end() && where[id] != status.begin() &&
+                    check(*std::prev(where[id]), *next)) {
+                    std::size_t a = *std::prev(where[id]), b = *next;
+                    return std::make_pair(std::min(a, b), std::max(a, b));
+                }
+                status.erase(where[id]);
+            }
+        }
+        return std::nullopt;
+    }
+
+    /*!
+    Алгоритм Бентли-Оттманна: находит все пересекающиеся пары отрезков за O((n + k) log n),
+    где k - число пар. Пары совпадают с теми, для которых Intersect возвращает true;
+    вертикальные, вырожденные и наложившиеся на одной прямой отрезки допускаются.
+    \param[in] segments Отрезки
+    \return Пары, упорядоченные по (first_, second_), вместе с точками пересечения
+    */
+    template <typename T>
+    std::vector<SegmentIntersection<T>> FindAllIntersections(
+            const std::vector<BasicSegment<T>> &segments) {
+        using Point = BasicVector<RealType<T>>;
+        std::vector<detail::SweepSegment<T>> sweep = detail::MakeSweepSegments(segments);
+
+        // Для каждой точки события - отрезки, которые в ней начинаются.
+        std::map<Point, std::vector<std::size_t>, detail::EventLess<T>> events;
+        for (std::size_t i = 0; i < segments.size(); ++i) {
+            events[sweep[i].p_].push_back(i);
+            events[sweep[i].q_];
+        }
+
+        Point sweep_point;
+        using Status = std::set<std::size_t, detail::StatusLess<T>>;
+        Status status(detail::StatusLess<T>(&sweep, &sweep_point));
+
+        // Пересечение соседей, лежащее правее текущего события, становится новым событием.
+        // Наложившиеся отрезки находятся без этого: начало одного лежит на другом.
+        auto find_new_event = [&](typename Status::iterator a, typename Status::iterator b) {
+            if (a == status.end() || b == status.end()) {
+                return;
+            }
+            IntersectionResult<T> intersection = Intersection(segments[*a], segments[*b]);
+            if (intersection.kind_ == IntersectionKind::kPoint &&
+                detail::EventLess<T>()(sweep_point, intersection.a_)) {
+                events[intersection.a_];
+            }
+        };
+
+        std::vector<SegmentIntersection<T>> result;
+        auto report = [&](std::size_t a, std::size_t b) {
+            result.push_back({std::min(a, b), std::max(a, b), sweep_point});
+        };
+        // Точная проверка, что отрезки лежат на одной прямой, без kEps на наклонах.
+        auto collinear = [&segments](std::size_t a, std::size_t b) {
+            const BasicSegment<T> &s = segments[a], &t = segments[b];
+            return Orient2D(s.a_, s.b_, t.a_) == 0 && Orient2D(s.a_, s.b_, t.b_) == 0;
+        };
+        std::vector<std::size_t> through, old, inserted;
+        std::vector<std::vector<std::size_t>> lines;
+        std::size_t line_count = 0;
+        while (!events.empty()) {
+            auto event = events.begin();
+            sweep_point = event->first;
+
+            // Все отрезки, проходящие через точку события: начинающиеся в ней и старые, то
+            // есть те, что уже лежат на заметающей прямой на этой высоте.
+            const std::vector<std::size_t> &starting = event->second;
+            auto range = status.equal_range(sweep_point.y_);
+            old.assign(range.first, range.second);
+
+            // Каждая пара выдаётся в одном событии, поэтому работа пропорциональна числу пар.
+            // Пары с начинающимся здесь отрезком новые.
+            for (std::size_t i = 0; i < starting.size(); ++i) {
+                for (std::size_t j = i + 1; j < starting.size(); ++j) {
+                    report(starting[i], starting[j]);
+                }
+                for (std::size_t id : old) {
+                    report(starting[i], id);
+                }
+            }
+            // Старые отрезки на одной прямой наложились и уже выданы в начале более позднего
+            // из них, остальные пары старых пересекаются здесь. Старые отрезки раскладываются
+            // по прямым; проверка прямой, с которой отрезок не совпал, окупается выданными
+            // парами, так что работа по-прежнему пропорциональна их числу.
+            line_count = 0;
+            for (std::size_t id : old) {
+                std::size_t own = line_count;
+                for (std::size_t line = 0; line < line_count; ++line) {
+                    if (own == line_count && collinear(lines[line].front(), id)) {
+                        own = line;
+                    } else {
+                        for (std::size_t other : lines[line]) {
+                            report(other, id);
+                        }
+                    }
+                }
+                if (own == line_count) {
+                    if (lines.size() == line_count) {
+                        lines.emplace_back();
+                    }
+                    lines[line_count++].clear();
+                }
+                lines[own].push_back(id);
+            }
+            through = starting;
+            through.insert(through.end(), old.begin(), old.end());
+
+            // Переставляем проходящие через точку отрезки в порядок сразу после неё, а
+            // закончившиеся в ней удаляем.
+            status.erase(range.first, range.second);
+            inserted.clear();
+            for (std::size_t id : through) {
+                if (!(sweep[id].q_ == sweep_point)) {
+                    status.insert(id);
+                    inserted.push_back(id);
+                }
+            }
+
+            range = status.equal_range(sweep_point.y_);
+            auto below = range.first == status.begin() ? status.end() : std::prev(range.first);
+            if (inserted.empty()) {
+                find_new_event(below, range.second);
+            } else {
+                find_new_event(below, range.first);
+                find_new_event(std::prev(range.second), range.second);
+            }
+            events.erase(event);
+        }
+
+        // Почти параллельные отрезки могут оказаться на одной высоте в нескольких соседних
+        // событиях; оставляем первое.
+        std::stable_sort(result.begin(), result.end(), [](const auto &a, const auto &b) {
+            return std::make_pair(a.first_, a.second_) < std::make_pair(b.first_, b.second_);
+        });
+        result.erase(std::unique(result.begin(), result.end(),
+                                 [](const auto &a, const auto &b) {
+                                     return a.first_ == b.first_ && a.second_ == b.second_;
+                                 }),
+                     result.end());
+        return result;
+    }
+    ///@}
+}
+
+#endif //OLYMP_GEOMETRY_SWEEP_LINE_H
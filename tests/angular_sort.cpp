@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "../lib/angular-sort.h"
+
+#include <random>
+
+template <typename T>
+class AngularSort : public ::testing::Test {};
+
+using CoordinateTypes = ::testing::Types<double, int64_t>;
+TYPED_TEST_SUITE(AngularSort, CoordinateTypes);
+
+TYPED_TEST(AngularSort, AngleLess) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    // По возрастанию угла от оси x против часовой стрелки.
+    std::vector<Vector> order = {{0, 0},  {3, 0},  {2, 1},   {1, 1},  {0, 5},
+                                 {-1, 1}, {-2, 0}, {-1, -1}, {0, -1}, {5, -1}};
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        for (std::size_t j = 0; j < order.size(); ++j) {
+            EXPECT_EQ(olymp_geometry::AngleLess(order[i], order[j]), i < j) << i << " " << j;
+        }
+    }
+    EXPECT_FALSE(olymp_geometry::AngleLess(Vector(1, 1), Vector(7, 7)));
+    EXPECT_FALSE(olymp_geometry::AngleLess(Vector(7, 7), Vector(1, 1)));
+    static_assert(olymp_geometry::AngleLess(olymp_geometry::BasicVector<TypeParam>(1, 0),
+                                            olymp_geometry::BasicVector<TypeParam>(0, 1)));
+}
+
+TEST(AngularSort, AngleLessIsExactForDoubles) {
+    using Vector = olymp_geometry::BasicVector<double>;
+    // Угол между векторами около 1e-17 радиан: VectorMultiplication даёт 0.
+    Vector a(1, 1e-17), b(1, 2e-17);
+    EXPECT_TRUE(olymp_geometry::AngleLess(a, b));
+    EXPECT_FALSE(olymp_geometry::AngleLess(b, a));
+}
+
+TYPED_TEST(AngularSort, SortByAngle) {
+    using T = TypeParam;
+    using Vector = olymp_geometry::BasicVector<T>;
+    std::mt19937_64 random(43);
+    for (std::size_t n : {0, 1, 10, 1000, 100000}) {
+        for (int range : {2, 1000}) {
+            std::uniform_int_distribution<int> coordinate(-range, range);
+            std::vector<Vector> points;
+            for (std::size_t i = 0; i < n; ++i) {
+                points.emplace_back(coordinate(random), coordinate(random));
+            }
+            Vector origin(coordinate(random), coordinate(random));
+            std::vector<Vector> expected = points;
+            std::stable_sort(expected.begin(), expected.end(),
+                             [&origin](const Vector &a, const Vector &b) {
+                                 return olymp_geometry::AngleLess(a - origin, b - origin);
+                             });
+            olymp_geometry::SetThreadCount(4);
+            olymp_geometry::SortByAngle(points, origin);
+            olymp_geometry::SetThreadCount(0);
+            ASSERT_EQ(points.size(), expected.size());
+            for (std::size_t i = 0; i < n; ++i) {
+                // Порядок на одном луче не определён, поэтому сравниваем направления.
+                ASSERT_FALSE(olymp_geometry::AngleLess(points[i] - origin, expected[i] - origin));
+                ASSERT_FALSE(olymp_geometry::AngleLess(expected[i] - origin, points[i] - origin));
+            }
+            // И это перестановка входа.
+            auto less_xy = [](const Vector &a, const Vector &b) {
+                return std::make_pair(a.x_, a.y_) < std::make_pair(b.x_, b.y_);
+            };
+            std::sort(expected.begin(), expected.end(), less_xy);
+            std::sort(points.begin(), points.end(), less_xy);
+            ASSERT_EQ(points, expected);
+        }
+    }
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "../lib/circle-cloud.h"
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace {
+    using olymp_geometry::SimdLevel;
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Segment = olymp_geometry::BasicSegment<double>;
+    using Circle = olymp_geometry::BasicCircle<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+
+    const SimdLevel kLevels[] = {SimdLevel::kScalar, SimdLevel::kSse2, SimdLevel::kAvx2,
+                                 SimdLevel::kAvx512};
+
+    // Целые координаты и радиусы на маленькой решётке дают много касаний и отрезков,
+    // концы которых лежат на окружности.
+    std::vector<Segment> RandomSegments(std::size_t size, int grid, uint32_t seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> coordinate(-grid, grid);
+        std::vector<Segment> segments;
+        for (std::size_t i = 0; i < size; ++i) {
+            segments.emplace_back(Vector(coordinate(gen), coordinate(gen)),
+                                  Vector(coordinate(gen), coordinate(gen)));
+        }
+        return segments;
+    }
+
+    std::vector<Circle> RandomCircles(std::size_t size, int grid, uint32_t seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> coordinate(-grid, grid), radius(0, grid);
+        std::vector<Circle> circles;
+        for (std::size_t i = 0; i < size; ++i) {
+            circles.emplace_back(Vector(coordinate(gen), coordinate(gen)), radius(gen));
+        }
+        return circles;
+    }
+}
+
+TEST(CircleCloud, Storage) {
+    std::vector<Circle> circles = RandomCircles(10, 5, 1);
+    olymp_geometry::CircleCloud cloud(circles);
+    ASSERT_EQ(cloud.Size(), circles.size());
+    for (std::size_t i = 0; i < circles.size(); ++i) {
+        EXPECT_EQ(cloud[i].center_, circles[i].center_);
+        EXPECT_EQ(cloud[i].radius_, circles[i].radius_);
+        EXPECT_EQ(cloud.R()[i], circles[i].radius_);
+    }
+    cloud.Clear();
+    EXPECT_TRUE(cloud.Empty());
+}
+
+TEST(CircleCloud, CircleAgainstSegmentsMatchesScalar) {
+    for (int grid : {3, 10, 1000}) {
+        std::vector<Segment> segments = RandomSegments(203, grid, grid);
+        olymp_geometry::SegmentCloud cloud(segments);
+        std::vector<Circle> queries = RandomCircles(30, grid, grid + 1);
+        for (SimdLevel level : kLevels) {
+            olymp_geometry::SetSimdLevel(level);
+            for (const Circle &query : queries) {
+                std::vector<uint64_t> mask((segments.size() + 63) / 64);
+                std::unique_ptr<bool[]> out(new bool[segments.size()]);
+                std::vector<double> dist(segments.size());
+                olymp_geometry::IntersectMask(query, cloud, mask.data());
+                olymp_geometry::Intersect(query, cloud, out.get());
+                olymp_geometry::Dist(query, cloud, dist.data());
+                for (std::size_t i = 0; i < segments.size(); ++i) {
+                    bool expected = olymp_geometry::Intersect(query, segments[i]);
+                    EXPECT_EQ((mask[i / 64] >> (i % 64)) & 1u, expected) << i;
+                    EXPECT_EQ(out[i], expected) << i;
+                    EXPECT_NEAR(dist[i], olymp_geometry::Dist(query, segments[i]), 1e-9 * grid)
+                            << i;
+                }
+            }
+        }
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
+
+TEST(CircleCloud, LineAgainstCirclesMatchesScalar) {
+    for (int grid : {3, 10, 1000}) {
+        std::vector<Circle> circles = RandomCircles(203, grid, grid);
+        olymp_geometry::CircleCloud cloud(circles);
+        std::vector<Segment> through = RandomSegments(30, grid, grid + 1);
+        for (SimdLevel level : kLevels) {
+            olymp_geometry::SetSimdLevel(level);
+            for (const Segment &s : through) {
+                if (s.a_ == s.b_) {
+                    continue;
+                }
+                Line line(s.a_, s.b_);
+                std::vector<uint64_t> mask((circles.size() + 63) / 64);
+                std::unique_ptr<bool[]> out(new bool[circles.size()]);
+                std::vector<double> dist(circles.size());
+                olymp_geometry::IntersectMask(line, cloud, mask.data());
+                olymp_geometry::Intersect(line, cloud, out.get());
+                olymp_geometry::Dist(line, cloud, dist.data());
+                for (std::size_t i = 0; i < circles.size(); ++i) {
+                    bool expected = olymp_geometry::Intersect(circles[i], line);
+                    EXPECT_EQ((mask[i / 64] >> (i % 64)) & 1u, expected) << i;
+                    EXPECT_EQ(out[i], expected) << i;
+                    EXPECT_NEAR(dist[i], olymp_geometry::Dist(circles[i], line), 1e-9 * grid)
+                            << i;
+                }
+            }
+        }
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
+
+TEST(CircleCloud, NearTangentMatchesScalar) {
+    // Нецелые круги и отрезки, касающиеся их с точностью до нескольких ulp от
+    // HitRadiusSquared: ответ решают последние биты, и FMA в ядрах меняла бы его.
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> coordinate(-100, 100), radius(0.5, 50),
+            angle(0, 6.283185307179586), along(1, 30), ulps(-8, 8);
+    const double kUlp = std::numeric_limits<double>::epsilon();
+    for (int query = 0; query < 16; ++query) {
+        Circle circle(Vector(coordinate(gen), coordinate(gen)), radius(gen));
+        double hit = std::sqrt(olymp_geometry::detail::HitRadiusSquared(circle));
+
+        // Отрезки на касательных: проекция центра внутри отрезка или конец на окружности.
+        std::vector<Segment> segments;
+        for (std::size_t i = 0; i < 1003; ++i) {
+            double phi = angle(gen), d = hit * (1 + ulps(gen) * kUlp);
+            Vector normal(std::cos(phi), std::sin(phi)), tangent(-normal.y_, normal.x_);
+            Vector touch(circle.center_.x_ + normal.x_ * d, circle.center_.y_ + normal.y_ * d);
+            double before = i % 2 == 0 ? along(gen) : 0, after = along(gen);
+            segments.emplace_back(
+                    Vector(touch.x_ - tangent.x_ * before, touch.y_ - tangent.y_ * before),
+                    Vector(touch.x_ + tangent.x_ * after, touch.y_ + tangent.y_ * after));
+        }
+        olymp_geometry::SegmentCloud segment_cloud(segments);
+
+        // Круги, центры которых отстоят от прямой на r + eps с точностью до ulp.
+        Vector a(coordinate(gen), coordinate(gen)), b(coordinate(gen), coordinate(gen));
+        Line line(a, b);
+        double length = std::sqrt(line.A_ * line.A_ + line.B_ * line.B_);
+        std::vector<Circle> circles;
+        for (std::size_t i = 0; i < 1003; ++i) {
+            double r = radius(gen), t = along(gen) / 30;
+            double d = (r + olymp_geometry::kEpsOf<double>) * (1 + ulps(gen) * kUlp);
+            d *= i % 2 == 0 ? 1 : -1;
+            circles.emplace_back(Vector(a.x_ + (b.x_ - a.x_) * t + line.A_ / length * d,
+                                        a.y_ + (b.y_ - a.y_) * t + line.B_ / length * d),
+                                 r);
+        }
+        olymp_geometry::CircleCloud circle_cloud(circles);
+
+        for (SimdLevel level : kLevels) {
+            olymp_geometry::SetSimdLevel(level);
+            std::vector<uint64_t> mask((segments.size() + 63) / 64);
+            std::unique_ptr<bool[]> out(new bool[circles.size()]);
+            olymp_geometry::IntersectMask(circle, segment_cloud, mask.data());
+            olymp_geometry::Intersect(line, circle_cloud, out.get());
+            std::size_t segment_mismatches = 0, line_mismatches = 0;
+            for (std::size_t i = 0; i < segments.size(); ++i) {
+                bool expected = olymp_geometry::Intersect(circle, segments[i]);
+                segment_mismatches += ((mask[i / 64] >> (i % 64)) & 1u) != expected;
+                line_mismatches += out[i] != olymp_geometry::Intersect(circles[i], line);
+            }
+            EXPECT_EQ(segment_mismatches, 0u) << static_cast<int>(level);
+            EXPECT_EQ(line_mismatches, 0u) << static_cast<int>(level);
+        }
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
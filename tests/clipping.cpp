@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "../lib/clipping.h"
+#include "../lib/half-plane.h"
+
+#include <random>
+
+template <typename T>
+class Clipping : public ::testing::Test {};
+
+using CoordinateTypes = ::testing::Types<double, int64_t>;
+TYPED_TEST_SUITE(Clipping, CoordinateTypes);
+
+namespace {
+    template <typename T>
+    using Points = std::vector<olymp_geometry::BasicVector<T>>;
+
+    template <typename U>
+    long double Area(const Points<U> &polygon) {
+        long double area = 0;
+        for (std::size_t i = 0; i < polygon.size(); ++i) {
+            area += olymp_geometry::VectorMultiplication(polygon[i],
+                                                         polygon[(i + 1) % polygon.size()]);
+        }
+        return area / 2;
+    }
+
+    // Полуплоскости слева от рёбер выпуклого многоугольника против часовой стрелки.
+    template <typename T>
+    void AddEdges(const Points<T> &polygon, std::vector<olymp_geometry::BasicLine<T>> &lines) {
+        for (std::size_t i = 0; i < polygon.size(); ++i) {
+            lines.emplace_back(polygon[(i + 1) % polygon.size()], polygon[i]);
+        }
+    }
+
+    // Площадь пересечения через HalfPlaneIntersection.
+    template <typename T>
+    long double IntersectionArea(const std::vector<olymp_geometry::BasicLine<T>> &lines) {
+        auto region = olymp_geometry::HalfPlaneIntersection(lines);
+        return region.kind_ == olymp_geometry::RegionKind::kEmpty ? 0 : Area(region.vertices_);
+    }
+
+    // Невырожденный треугольник против часовой стрелки с целыми координатами.
+    template <typename T>
+    Points<T> RandomTriangle(std::mt19937 &gen) {
+        std::uniform_int_distribution<int> coordinate(-10, 10);
+        while (true) {
+            Points<T> triangle;
+            for (int k = 0; k < 3; ++k) {
+                triangle.emplace_back(coordinate(gen), coordinate(gen));
+            }
+            int orientation = olymp_geometry::Orient2D(triangle[0], triangle[1], triangle[2]);
+            if (orientation != 0) {
+                if (orientation < 0) {
+                    std::swap(triangle[1], triangle[2]);
+                }
+                return triangle;
+            }
+        }
+    }
+}
+
+TYPED_TEST(Clipping, ByLine) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+    Points<TypeParam> square = {Vector(0, 0), Vector(4, 0), Vector(4, 4), Vector(0, 4)};
+    olymp_geometry::ClipBuffers<TypeParam> buffers;
+
+    const auto &result =
+            olymp_geometry::ClipByLine(square, Line(Vector(1, 0), Vector(1, 1)), Vector(3, 0),
+                                       buffers);
+    ASSERT_EQ(result.size(), 4u);
+    EXPECT_FLOAT_EQ(result[0].x_, 1);
+    EXPECT_FLOAT_EQ(result[0].y_, 0);
+    EXPECT_FLOAT_EQ(result[1].x_, 4);
+    EXPECT_FLOAT_EQ(result[3].x_, 1);
+    EXPECT_FLOAT_EQ(result[3].y_, 4);
+    EXPECT_FLOAT_EQ(Area(result), 12);
+
+    // Вершины на прямой остаются, новых не появляется.
+    olymp_geometry::ClipByLine(square, Line(Vector(0, 0), Vector(1, 1)), Vector(3, 1), buffers);
+    EXPECT_EQ(buffers.result_.size(), 3u);
+    EXPECT_FLOAT_EQ(Area(buffers.result_), 8);
+
+    olymp_geometry::ClipByLine(square, Line(Vector(5, 0), Vector(5, 1)), Vector(6, 0), buffers);
+    EXPECT_TRUE(buffers.result_.empty());
+    olymp_geometry::ClipByLine(square, Line(Vector(5, 0), Vector(5, 1)), Vector(5, 7), buffers);
+    EXPECT_EQ(buffers.result_.size(), 4u);
+    olymp_geometry::ClipByLine(Points<TypeParam>(), Line(Vector(5, 0), Vector(5, 1)),
+                               Vector(0, 0), buffers);
+    EXPECT_TRUE(buffers.result_.empty());
+}
+
+TYPED_TEST(Clipping, ByWindow) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    Points<TypeParam> triangle = {Vector(-1, 0), Vector(5, 0), Vector(2, 6)};
+    olymp_geometry::ClipBuffers<TypeParam> buffers;
+    for (bool clockwise : {false, true}) {
+        olymp_geometry::BasicPolygon<TypeParam> window =
+                clockwise ? olymp_geometry::BasicPolygon<TypeParam>{{0, 0}, {0, 4}, {4, 4}, {4, 0}}
+                          : olymp_geometry::BasicPolygon<TypeParam>{{0, 0}, {4, 0}, {4, 4}, {0, 4}};
+        const auto &result = olymp_geometry::ClipByWindow(triangle, window, buffers);
+        // Квадрат без двух уголков у верхней стороны: y = 2x + 2 при x < 1 и y = 10 - 2x
+        // при x > 3.
+        EXPECT_FLOAT_EQ(Area(result), 14);
+        for (const auto &p : result) {
+            EXPECT_GE(p.x_, 0);
+            EXPECT_LE(p.x_, 4);
+            EXPECT_GE(p.y_, 0);
+            EXPECT_LE(p.y_, 4);
+        }
+    }
+    olymp_geometry::BasicPolygon<TypeParam> far{{10, 10}, {14, 10}, {14, 14}};
+    EXPECT_TRUE(olymp_geometry::ClipByWindow(triangle, far, buffers).empty());
+}
+
+TYPED_TEST(Clipping, MatchesHalfPlaneIntersection) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> coordinate(-10, 10);
+    olymp_geometry::ClipBuffers<TypeParam> buffers;
+    for (int iteration = 0; iteration < 300; ++iteration) {
+        Points<TypeParam> polygon = RandomTriangle<TypeParam>(gen);
+        Points<TypeParam> window = RandomTriangle<TypeParam>(gen);
+        std::vector<Line> lines;
+        AddEdges(polygon, lines);
+        AddEdges(window, lines);
+        if (iteration % 2 == 1) {
+            std::reverse(window.begin(), window.end());
+        }
+        olymp_geometry::ClipByWindow(polygon, olymp_geometry::BasicPolygon<TypeParam>(window),
+                                     buffers);
+        EXPECT_NEAR(Area(buffers.result_), IntersectionArea(lines), 1e-9) << iteration;
+
+        Vector a(coordinate(gen), coordinate(gen)), b(coordinate(gen), coordinate(gen));
+        Vector inside(coordinate(gen), coordinate(gen));
+        Line line(a, b);
+        int side = olymp_geometry::SideOfLine(line, inside);
+        if (a == b || side == 0) {
+            continue;
+        }
+        lines.clear();
+        AddEdges(polygon, lines);
+        lines.push_back(side > 0 ? line : Line(-line.A_, -line.B_, -line.C_));
+        olymp_geometry::ClipByLine(polygon, line, inside, buffers);
+        EXPECT_NEAR(Area(buffers.result_), IntersectionArea(lines), 1e-9) << iteration;
+    }
+}
+
+TYPED_TEST(Clipping, BatchMatchesSingle) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+    std::mt19937 gen(11);
+    Points<TypeParam> vertices;
+    std::vector<std::size_t> offsets = {0};
+    std::vector<Points<TypeParam>> polygons;
+    for (int i = 0; i < 100; ++i) {
+        polygons.push_back(RandomTriangle<TypeParam>(gen));
+        vertices.insert(vertices.end(), polygons.back().begin(), polygons.back().end());
+        offsets.push_back(vertices.size());
+    }
+    olymp_geometry::BasicPolygon<TypeParam> window{{-5, -5}, {5, -5}, {5, 5}, {-5, 5}};
+    Line line(Vector(-3, -10), Vector(4, 10));
+    Vector inside(10, 0);
+
+    olymp_geometry::ClipBuffers<TypeParam> buffers, single;
+    Points<olymp_geometry::RealType<TypeParam>> out;
+    std::vector<std::size_t> out_offsets;
+    for (bool by_window : {false, true}) {
+        if (by_window) {
+            olymp_geometry::ClipByWindow(vertices, offsets, window, out, out_offsets, buffers);
+        } else {
+            olymp_geometry::ClipByLine(vertices, offsets, line, inside, out, out_offsets,
+                                       buffers);
+        }
+        ASSERT_EQ(out_offsets.size(), offsets.size());
+        for (std::size_t i = 0; i < polygons.size(); ++i) {
+            const auto &expected =
+                    by_window ? olymp_geometry::ClipByWindow(polygons[i], window, single)
+                              : olymp_geometry::ClipByLine(polygons[i], line, inside, single);
+            ASSERT_EQ(out_offsets[i + 1] - out_offsets[i], expected.size()) << i;
+            for (std::size_t k = 0; k < expected.size(); ++k) {
+                EXPECT_EQ(out[out_offsets[i] + k], expected[k]) << i;
+            }
+        }
+    }
+}
+
+TYPED_TEST(Clipping, GeometryStore) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    std::mt19937 gen(13);
+    olymp_geometry::BasicGeometryStore<TypeParam> shapes;
+    Points<TypeParam> vertices;
+    std::vector<std::size_t> offsets = {0};
+    for (int i = 0; i < 50; ++i) {
+        Points<TypeParam> triangle = RandomTriangle<TypeParam>(gen);
+        shapes.Add(triangle);
+        vertices.insert(vertices.end(), triangle.begin(), triangle.end());
+        offsets.push_back(vertices.size());
+    }
+    olymp_geometry::BasicPolygon<TypeParam> window{{-5, -5}, {5, -5}, {5, 5}, {-5, 5}};
+    olymp_geometry::ClipBuffers<TypeParam> buffers;
+    olymp_geometry::BasicGeometryStore<olymp_geometry::RealType<TypeParam>> out;
+    Points<olymp_geometry::RealType<TypeParam>> expected;
+    std::vector<std::size_t> expected_offsets;
+
+    olymp_geometry::ClipByWindow(shapes, window, out, buffers);
+    olymp_geometry::ClipByWindow(vertices, offsets, window, expected, expected_offsets, buffers);
+    EXPECT_EQ(out.Offsets().size(), expected_offsets.size());
+    EXPECT_TRUE(std::equal(out.Vertices().begin(), out.Vertices().end(), expected.begin(),
+                           expected.end()));
+
+    olymp_geometry::BasicLine<TypeParam> line(Vector(0, -10), Vector(1, 10));
+    olymp_geometry::ClipByLine(shapes, line, Vector(10, 0), out, buffers);
+    olymp_geometry::ClipByLine(vertices, offsets, line, Vector(10, 0), expected,
+                               expected_offsets, buffers);
+    EXPECT_TRUE(std::equal(out.Offsets().begin(), out.Offsets().end(),
+                           expected_offsets.begin(), expected_offsets.end()));
+    EXPECT_TRUE(std::equal(out.Vertices().begin(), out.Vertices().end(), expected.begin(),
+                           expected.end()));
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "../lib/closest-pair.h"
+
+#include <random>
+
+template <typename T>
+class ClosestPair : public ::testing::Test {};
+
+using CoordinateTypes = ::testing::Types<double, int64_t>;
+TYPED_TEST_SUITE(ClosestPair, CoordinateTypes);
+
+namespace {
+    template <typename T>
+    using Points = std::vector<olymp_geometry::BasicVector<T>>;
+
+    template <typename T>
+    Points<T> RandomPoints(std::size_t n, int range, std::mt19937_64 &random) {
+        std::uniform_int_distribution<int> coordinate(-range, range);
+        Points<T> points;
+        for (std::size_t i = 0; i < n; ++i) {
+            points.emplace_back(coordinate(random), coordinate(random));
+        }
+        return points;
+    }
+
+    template <typename T>
+    long double BruteForce(const Points<T> &points) {
+        long double best = std::numeric_limits<long double>::infinity();
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            for (std::size_t j = i + 1; j < points.size(); ++j) {
+                best = std::min<long double>(best,
+                                             olymp_geometry::DistSquared(points[i], points[j]));
+            }
+        }
+        return best;
+    }
+}
+
+TYPED_TEST(ClosestPair, Small) {
+    using T = TypeParam;
+    EXPECT_FALSE(olymp_geometry::ClosestPair(Points<T>{}));
+    EXPECT_FALSE(olymp_geometry::ClosestPair(Points<T>{{1, 1}}));
+    Points<T> points = {{0, 0}, {10, 10}, {3, 4}, {11, 10}, {-5, 2}};
+    auto pair = olymp_geometry::ClosestPair(points);
+    ASSERT_TRUE(pair);
+    EXPECT_EQ(pair->first, 1u);
+    EXPECT_EQ(pair->second, 3u);
+}
+
+TYPED_TEST(ClosestPair, MatchesBruteForce) {
+    using T = TypeParam;
+    std::mt19937_64 random(31);
+    for (std::size_t n : {2, 3, 4, 10, 100, 2000}) {
+        for (int range : {5, 1000000}) {
+            Points<T> points = RandomPoints<T>(n, range, random);
+            auto [i, j] = *olymp_geometry::ClosestPair(points);
+            ASSERT_LT(i, j);
+            ASSERT_EQ(static_cast<long double>(olymp_geometry::DistSquared(points[i], points[j])),
+                      BruteForce(points));
+        }
+    }
+    // Все точки на одной вертикали: полоса у средней прямой содержит всё множество.
+    Points<T> vertical;
+    for (int i = 0; i < 1000; ++i) {
+        vertical.emplace_back(7, i * i);
+    }
+    auto [i, j] = *olymp_geometry::ClosestPair(vertical);
+    EXPECT_EQ(i, 0u);
+    EXPECT_EQ(j, 1u);
+}
+
+TYPED_TEST(ClosestPair, Parallel) {
+    using T = TypeParam;
+    std::mt19937_64 random(37);
+    Points<T> points = RandomPoints<T>(200000, 1000000000, random);
+    olymp_geometry::SetThreadCount(1);
+    auto sequential = olymp_geometry::ClosestPair(points);
+    olymp_geometry::SetThreadCount(4);
+    auto parallel = olymp_geometry::ClosestPair(points);
+    olymp_geometry::SetThreadCount(0);
+    EXPECT_EQ(parallel, sequential);
+}
+
+TYPED_TEST(ClosestPair, ClosePairs) {
+    using T = TypeParam;
+    std::mt19937_64 random(41);
+    for (std::size_t n : {1, 10, 300, 1500}) {
+        for (int range : {3, 1000}) {
+            Points<T> points = RandomPoints<T>(n, range, random);
+            for (long double distance : {0.0L, 1.5L, 40.0L}) {
+                std::vector<std::pair<std::size_t, std::size_t>> expected;
+                for (std::size_t i = 0; i < n; ++i) {
+                    for (std::size_t j = i + 1; j < n; ++j) {
+                        if (olymp_geometry::DistSquared(points[i], points[j]) <=
+                            distance * distance) {
+                            expected.emplace_back(i, j);
+                        }
+                    }
+                }
+                olymp_geometry::SetThreadCount(4);
+                ASSERT_EQ(olymp_geometry::FindClosePairs(points, distance), expected);
+                olymp_geometry::SetThreadCount(0);
+                std::vector<std::pair<std::size_t, std::size_t>> streamed;
+                olymp_geometry::ForEachClosePair(
+                        points, distance,
+                        [&](std::size_t i, std::size_t j) { streamed.emplace_back(i, j); });
+                std::sort(streamed.begin(), streamed.end());
+                ASSERT_EQ(streamed, expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "../lib/convex-hull.h"
+
+#include <random>
+
+template <typename T>
+class ConvexHull : public ::testing::Test {};
+
+using CoordinateTypes = ::testing::Types<double, int64_t>;
+TYPED_TEST_SUITE(ConvexHull, CoordinateTypes);
+
+namespace {
+    template <typename T>
+    using Points = std::vector<olymp_geometry::BasicVector<T>>;
+
+    // Проверяет оболочку перебором: вершины из входа, повороты против часовой стрелки, все
+    // точки внутри или на границе, а при keep_collinear на границе нет пропущенных точек.
+    template <typename T>
+    void ExpectHull(const Points<T> &points, const Points<T> &hull, bool keep_collinear) {
+        ASSERT_GE(hull.size(), 3u);
+        std::size_t m = hull.size();
+        for (std::size_t i = 0; i < m; ++i) {
+            const auto &a = hull[i], &b = hull[(i + 1) % m], &c = hull[(i + 2) % m];
+            ASSERT_NE(std::find(points.begin(), points.end(), a), points.end());
+            int turn = olymp_geometry::Orient2D(a, b, c);
+            ASSERT_TRUE(keep_collinear ? turn >= 0 : turn > 0);
+        }
+        for (const auto &p : points) {
+            bool on_boundary = false;
+            for (std::size_t i = 0; i < m; ++i) {
+                int side = olymp_geometry::Orient2D(hull[i], hull[(i + 1) % m], p);
+                ASSERT_GE(side, 0);
+                on_boundary |= side == 0;
+            }
+            if (keep_collinear && on_boundary) {
+                ASSERT_NE(std::find(hull.begin(), hull.end(), p), hull.end());
+            }
+        }
+    }
+
+    template <typename T>
+    Points<T> RandomPoints(std::size_t n, int range, std::mt19937_64 &random) {
+        std::uniform_int_distribution<int> coordinate(-range, range);
+        Points<T> points;
+        for (std::size_t i = 0; i < n; ++i) {
+            points.emplace_back(coordinate(random), coordinate(random));
+        }
+        return points;
+    }
+}
+
+TYPED_TEST(ConvexHull, Square) {
+    using T = TypeParam;
+    Points<T> points = {{2, 2}, {0, 0}, {4, 0}, {1, 3}, {4, 4}, {0, 4}, {2, 0}, {4, 2}, {0, 0}};
+    Points<T> expected = {{0, 0}, {4, 0}, {4, 4}, {0, 4}};
+    EXPECT_EQ(olymp_geometry::ConvexHull(points), expected);
+    Points<T> with_collinear = {{0, 0}, {2, 0}, {4, 0}, {4, 2}, {4, 4}, {0, 4}};
+    EXPECT_EQ(olymp_geometry::ConvexHull(points, true), with_collinear);
+}
+
+TYPED_TEST(ConvexHull, Degenerate) {
+    using T = TypeParam;
+    EXPECT_TRUE(olymp_geometry::ConvexHull(Points<T>{}).empty());
+    EXPECT_EQ(olymp_geometry::ConvexHull(Points<T>{{1, 1}, {1, 1}}), (Points<T>{{1, 1}}));
+    Points<T> line = {{3, 3}, {1, 1}, {2, 2}, {0, 0}, {2, 2}};
+    EXPECT_EQ(olymp_geometry::ConvexHull(line), (Points<T>{{0, 0}, {3, 3}}));
+    EXPECT_EQ(olymp_geometry::ConvexHull(line, true),
+              (Points<T>{{0, 0}, {1, 1}, {2, 2}, {3, 3}}));
+}
+
+TYPED_TEST(ConvexHull, MatchesBruteForce) {
+    using T = TypeParam;
+    std::mt19937_64 random(23);
+    for (std::size_t n : {3, 10, 100, 1000}) {
+        for (int range : {3, 1000}) {
+            Points<T> points = RandomPoints<T>(n, range, random);
+            for (bool keep_collinear : {false, true}) {
+                Points<T> hull = olymp_geometry::ConvexHull(points, keep_collinear);
+                if (hull.size() >= 3) {
+                    ExpectHull(points, hull, keep_collinear);
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(ConvexHull, Parallel) {
+    using T = TypeParam;
+    std::mt19937_64 random(29);
+    Points<T> points = RandomPoints<T>(300000, 1000000, random);
+    // Точки на стороне квадрата проходят отсев, и на части делятся уже сами кандидаты.
+    for (int i = 0; i < 200000; ++i) {
+        points.emplace_back(1000000, i * 7 - 700000);
+    }
+    for (bool keep_collinear : {false, true}) {
+        olymp_geometry::SetThreadCount(1);
+        Points<T> sequential = olymp_geometry::ConvexHull(points, keep_collinear);
+        olymp_geometry::SetThreadCount(4);
+        Points<T> parallel = olymp_geometry::ConvexHull(points, keep_collinear);
+        olymp_geometry::SetThreadCount(0);
+        EXPECT_EQ(parallel, sequential);
+        auto on_side = std::count_if(parallel.begin(), parallel.end(),
+                                     [](const auto &v) { return v.x_ == 1000000; });
+        EXPECT_EQ(on_side >= 200000, keep_collinear);
+    }
+}
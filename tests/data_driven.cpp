@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+#include "../lib/convex-hull.h"
+#include "../lib/fast-io.h"
+#include "../lib/olymp-geometry.h"
+#include "../lib/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+// Тесты на данных: каталог tests/data/<операция> содержит пары файлов NNN (вход) и NNN.a
+// (ожидаемые числа через пробельные символы) и необязательный файл budget_ms - сколько
+// миллисекунд может идти один случай. Каждый каталог - отдельный тест DataDriven.<операция>,
+// случаи внутри него идут в GetThreadCount() потоках, время каждого записывается в свойства
+// теста. Случай, не уложившийся в бюджет, - провал, так что большие входы проверяют и
+// скорость, а не только ответ.
+
+namespace {
+    namespace fs = std::filesystem;
+    using Vector = olymp_geometry::BasicVector<int64_t>;
+    using Segment = olymp_geometry::BasicSegment<int64_t>;
+    using Reader = olymp_geometry::FastReader;
+    using Operation = std::function<void(Reader &, std::vector<long double> &)>;
+
+    constexpr long long kDefaultBudgetMs = 1000;
+
+    // Читает число запросов и для каждого дописывает в out ответ query.
+    template <typename Query>
+    Operation ForEachQuery(Query query) {
+        return [query](Reader &in, std::vector<long double> &out) {
+            std::size_t q = 0;
+            in.Read(q);
+            for (std::size_t i = 0; i < q; ++i) {
+                out.push_back(query(in));
+            }
+        };
+    }
+
+    // Операции по имени каталога.
+    const std::map<std::string, Operation> &Operations() {
+        static const std::map<std::string, Operation> operations = {
+                {"vector_length",
+                 [](Reader &in, std::vector<long double> &out) {
+                     olymp_geometry::Vector a, b;
+                     in.Read(a);
+                     in.Read(b);
+                     out.push_back((b - a).Length());
+                 }},
+                {"intersect_segments", ForEachQuery([](Reader &in) {
+                     Segment a, b;
+                     in.Read(a);
+                     in.Read(b);
+                     return olymp_geometry::Intersect(a, b);
+                 })},
+                {"lies_on_segment", ForEachQuery([](Reader &in) {
+                     Vector p;
+                     Segment s;
+                     in.Read(p);
+                     in.Read(s);
+                     return olymp_geometry::LiesOn(s, p);
+                 })},
+                {"dist_point_segment", ForEachQuery([](Reader &in) {
+                     Vector p;
+                     Segment s;
+                     in.Read(p);
+                     in.Read(s);
+                     return olymp_geometry::Dist(s, p);
+                 })},
+                {"convex_hull",
+                 [](Reader &in, std::vector<long double> &out) {
+                     std::size_t n = 0;
+                     in.Read(n);
+                     std::vector<Vector> points;
+                     in.Read(points, n);
+                     std::vector<Vector> hull = olymp_geometry::ConvexHull(points);
+                     long double area = 0;
+                     for (std::size_t i = 0; i < hull.size(); ++i) {
+                         area += olymp_geometry::VectorMultiplication(
+                                 hull[i], hull[(i + 1) % hull.size()]);
+                     }
+                     out.push_back(hull.size());
+                     out.push_back(area / 2);
+                 }},
+        };
+        return operations;
+    }
+
+    struct CaseResult {
+        std::string name_;
+        double milliseconds_ = 0;
+        //! Пусто, если ответ верный
+        std::string error_;
+    };
+
+    std::vector<long double> ReadNumbers(const std::string &path) {
+        olymp_geometry::MappedFile file(path);
+        Reader in(file.View());
+        std::vector<long double> numbers;
+        long double value;
+        while (!in.AtEnd() && in.Read(value)) {
+            numbers.push_back(value);
+        }
+        return numbers;
+    }
+
+    std::string Compare(const std::vector<long double> &actual,
+                        const std::vector<long double> &expected) {
+        if (actual.size() != expected.size()) {
+            return "got " + std::to_string(actual.size()) + " numbers, expected " +
+                   std::to_string(expected.size());
+        }
+        for (std::size_t i = 0; i < actual.size(); ++i) {
+            long double tolerance = 1e-6L * std::max(1.0L, std::abs(expected[i]));
+            if (!(std::abs(actual[i] - expected[i]) <= tolerance)) {
+                return "number " + std::to_string(i) + ": got " + std::to_string(actual[i]) +
+                       ", expected " + std::to_string(expected[i]);
+            }
+        }
+        return "";
+    }
+
+    CaseResult RunCase(const Operation &operation, const fs::path &input) {
+        CaseResult result;
+        result.name_ = input.filename().string();
+        auto start = std::chrono::steady_clock::now();
+        olymp_geometry::MappedFile file(input.string());
+        Reader in(file.View());
+        std::vector<long double> actual;
+        operation(in, actual);
+        std::chrono::duration<double, std::milli> elapsed =
+                std::chrono::steady_clock::now() - start;
+        result.milliseconds_ = elapsed.count();
+        if (!file.IsOpen() || in.Failed()) {
+            result.error_ = "malformed input";
+        } else {
+            result.error_ = Compare(actual, ReadNumbers(input.string() + ".a"));
+        }
+        return result;
+    }
+
+    // Входы каталога: файлы без расширения, у которых есть пара NNN.a.
+    std::vector<fs::path> FindCases(const fs::path &directory) {
+        std::vector<fs::path> cases;
+        for (const fs::directory_entry &entry : fs::directory_iterator(directory)) {
+            fs::path path = entry.path();
+            if (entry.is_regular_file() && !path.has_extension() &&
+                fs::exists(path.string() + ".a")) {
+                cases.push_back(path);
+            }
+        }
+        std::sort(cases.begin(), cases.end());
+        return cases;
+    }
+
+    long long ReadBudget(const fs::path &directory) {
+        olymp_geometry::MappedFile file((directory / "budget_ms").string());
+        long long budget = kDefaultBudgetMs;
+        if (file.IsOpen()) {
+            Reader(file.View()).Read(budget);
+        }
+        return budget;
+    }
+
+    class DataDirectoryTest : public ::testing::Test {
+    public:
+        DataDirectoryTest(std::string operation, fs::path directory)
+            : operation_(std::move(operation)), directory_(std::move(directory)) {
+        }
+
+        void TestBody() override {
+            auto found = Operations().find(operation_);
+            ASSERT_NE(found, Operations().end()) << "no operation for " << directory_;
+            std::vector<fs::path> cases = FindCases(directory_);
+            ASSERT_FALSE(cases.empty()) << "no cases in " << directory_;
+            long long budget = ReadBudget(directory_);
+
+            // Потоки разбирают случаи по одному, так что один большой случай не задерживает
+            // остальные.
+            std::vector<CaseResult> results(cases.size());
+            std::atomic<std::size_t> next{0};
+            std::size_t workers = std::min<std::size_t>(olymp_geometry::GetThreadCount(),
+                                                        cases.size());
+            olymp_geometry::detail::ParallelFor(0, workers, 1, [&](std::size_t, std::size_t) {
+                for (std::size_t i = next++; i < cases.size(); i = next++) {
+                    results[i] = RunCase(found->second, cases[i]);
+                }
+            });
+
+            for (const CaseResult &result : results) {
+                RecordProperty(result.name_ + "_ms", std::to_string(result.milliseconds_));
+                EXPECT_EQ(result.error_, "") << directory_ / result.name_;
+                EXPECT_LE(result.milliseconds_, budget)
+                        << directory_ / result.name_ << " is over the time budget";
+            }
+        }
+
+    private:
+        std::string operation_;
+        fs::path directory_;
+    };
+
+    // Регистрирует тест на каждый каталог до запуска main.
+    void RegisterDirectory(const std::string &operation, const fs::path &directory) {
+        ::testing::RegisterTest("DataDriven", operation.c_str(), nullptr, nullptr, __FILE__,
+                                __LINE__, [=]() -> ::testing::Test * {
+                                    return new DataDirectoryTest(operation, directory);
+                                });
+    }
+
+    const bool kRegistered = [] {
+        fs::path root(OLYMP_GEOMETRY_TEST_DATA);
+        std::vector<fs::path> directories;
+        for (const fs::directory_entry &entry : fs::directory_iterator(root / "data")) {
+            if (entry.is_directory()) {
+                directories.push_back(entry.path());
+            }
+        }
+        std::sort(directories.begin(), directories.end());
+        for (const fs::path &directory : directories) {
+            RegisterDirectory(directory.filename().string(), directory);
+        }
+        // Старый каталог tests/vector_length в том же формате.
+        RegisterDirectory("vector_length", root / "vector_length");
+        return true;
+    }();
+}
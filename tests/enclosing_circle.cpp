@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "../lib/enclosing-circle.h"
+
+#include <random>
+
+template <typename T>
+class EnclosingCircle : public ::testing::Test {};
+
+using CoordinateTypes = ::testing::Types<double, int64_t>;
+TYPED_TEST_SUITE(EnclosingCircle, CoordinateTypes);
+
+namespace {
+    template <typename T>
+    using Points = std::vector<olymp_geometry::BasicVector<T>>;
+
+    template <typename T>
+    bool CoversAll(const olymp_geometry::BasicCircle<long double> &circle, const Points<T> &points,
+                   long double tolerance) {
+        for (const auto &p : points) {
+            if (olymp_geometry::Dist(circle.center_, olymp_geometry::BasicVector<long double>(p)) >
+                circle.radius_ + tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Перебор: наименьший круг проходит через две точки как диаметр или через три точки.
+    template <typename T>
+    long double BruteForceRadius(const Points<T> &points) {
+        using Point = olymp_geometry::BasicVector<long double>;
+        using Circle = olymp_geometry::BasicCircle<long double>;
+        std::size_t n = points.size();
+        std::vector<Point> p(points.begin(), points.end());
+        long double best = std::numeric_limits<long double>::infinity();
+        auto consider = [&](const Circle &circle) {
+            if (circle.radius_ < best && CoversAll(circle, points, 1e-9)) {
+                best = circle.radius_;
+            }
+        };
+        consider(Circle(p[0], 0));
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = i + 1; j < n; ++j) {
+                Point center((p[i].x_ + p[j].x_) / 2, (p[i].y_ + p[j].y_) / 2);
+                consider(Circle(center, olymp_geometry::Dist(center, p[i])));
+                for (std::size_t k = j + 1; k < n; ++k) {
+                    Point ab = p[j] - p[i], ac = p[k] - p[i];
+                    long double cross = olymp_geometry::VectorMultiplication(ab, ac);
+                    if (cross == 0) {
+                        continue;
+                    }
+                    long double b = olymp_geometry::ScalarMultiplication(ab, ab);
+                    long double c = olymp_geometry::ScalarMultiplication(ac, ac);
+                    Point offset((ac.y_ * b - ab.y_ * c) / (2 * cross),
+                                 (ab.x_ * c - ac.x_ * b) / (2 * cross));
+                    consider(Circle(p[i] + offset, offset.Length()));
+                }
+            }
+        }
+        return best;
+    }
+}
+
+TYPED_TEST(EnclosingCircle, Small) {
+    using T = TypeParam;
+    Points<T> empty;
+    EXPECT_EQ(olymp_geometry::MinEnclosingCircle(empty).radius_, 0);
+    Points<T> one = {{3, 4}};
+    auto circle = olymp_geometry::MinEnclosingCircle(one);
+    EXPECT_EQ(circle.radius_, 0);
+    EXPECT_EQ(circle.center_.x_, 3);
+    Points<T> square = {{0, 0}, {2, 0}, {2, 2}, {0, 2}, {1, 1}, {1, 0}};
+    circle = olymp_geometry::MinEnclosingCircle(square);
+    EXPECT_FLOAT_EQ(circle.center_.x_, 1);
+    EXPECT_FLOAT_EQ(circle.center_.y_, 1);
+    EXPECT_FLOAT_EQ(circle.radius_, std::sqrt(2.0L));
+    // Все точки на одной прямой и повторы.
+    Points<T> collinear = {{0, 0}, {1, 1}, {5, 5}, {2, 2}, {5, 5}, {3, 3}};
+    circle = olymp_geometry::MinEnclosingCircle(collinear);
+    EXPECT_FLOAT_EQ(circle.radius_, 5 * std::sqrt(2.0L) / 2);
+}
+
+TYPED_TEST(EnclosingCircle, MatchesBruteForce) {
+    using T = TypeParam;
+    std::mt19937 random(20);
+    for (int grid : {3, 1000}) {
+        std::uniform_int_distribution<int> coordinate(-grid, grid);
+        for (int test = 0; test < 100; ++test) {
+            Points<T> points(std::uniform_int_distribution<int>(1, 25)(random));
+            for (auto &p : points) {
+                p = olymp_geometry::BasicVector<T>(coordinate(random), coordinate(random));
+            }
+            long double expected = BruteForceRadius(points);
+            Points<T> shuffled = points;
+            auto circle = olymp_geometry::MinEnclosingCircle(shuffled, test);
+            ASSERT_NEAR(circle.radius_, expected, 1e-9 * grid);
+            ASSERT_TRUE(CoversAll(olymp_geometry::BasicCircle<long double>(circle), points,
+                                  1e-9 * grid));
+        }
+    }
+}
+
+TEST(EnclosingCircle, Large) {
+    // Без рекурсии миллион точек не упирается в глубину стека.
+    std::mt19937 random(1);
+    std::normal_distribution<double> coordinate(0, 1000);
+    Points<double> points(1'000'000);
+    for (auto &p : points) {
+        p = olymp_geometry::BasicVector<double>(coordinate(random), coordinate(random));
+    }
+    points.emplace_back(1e5, 0);
+    points.emplace_back(-1e5, 0);
+    Points<double> copy = points;
+    auto circle = olymp_geometry::MinEnclosingCircle(copy);
+    EXPECT_NEAR(circle.radius_, 1e5, 1e-6);
+    EXPECT_NEAR(circle.center_.x_, 0, 1e-6);
+    EXPECT_TRUE(CoversAll(olymp_geometry::BasicCircle<long double>(circle), points, 1e-6));
+}
+
+TEST(EnclosingCircle, Batch) {
+    std::mt19937 random(2);
+    std::uniform_real_distribution<double> coordinate(-1e3, 1e3);
+    std::vector<Points<double>> groups(200);
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        groups[i].resize(i * 37 % 500);
+        for (auto &p : groups[i]) {
+            p = olymp_geometry::BasicVector<double>(coordinate(random), coordinate(random));
+        }
+    }
+    std::vector<Points<double>> single_thread = groups;
+    olymp_geometry::SetThreadCount(1);
+    auto expected = olymp_geometry::MinEnclosingCircles(single_thread, 5);
+    olymp_geometry::SetThreadCount(4);
+    std::vector<Points<double>> copy = groups;
+    auto circles = olymp_geometry::MinEnclosingCircles(copy, 5);
+    olymp_geometry::SetThreadCount(0);
+    ASSERT_EQ(circles.size(), groups.size());
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+        EXPECT_EQ(circles[i].center_.x_, expected[i].center_.x_);
+        EXPECT_EQ(circles[i].radius_, expected[i].radius_);
+        Points<double> one = groups[i];
+        EXPECT_EQ(olymp_geometry::MinEnclosingCircle(one, 5 + i).radius_, circles[i].radius_);
+        EXPECT_TRUE(CoversAll(olymp_geometry::BasicCircle<long double>(circles[i]), groups[i],
+                              1e-9));
+    }
+}
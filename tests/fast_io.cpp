@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "../lib/fast-io.h"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+using olymp_geometry::FastReader;
+using olymp_geometry::FastWriter;
+
+TEST(FastIo, ReadsLikeIstream) {
+    std::string input = "1 2\n  -3.5 +4e2\t0.125\r\n7 8 9 10 11 12 13 14";
+    FastReader reader(input);
+    std::istringstream stream(input);
+
+    olymp_geometry::BasicVector<double> a, expected_a;
+    olymp_geometry::BasicLine<double> line, expected_line;
+    olymp_geometry::BasicSegment<double> segment, expected_segment;
+    ASSERT_TRUE(reader.Read(a));
+    ASSERT_TRUE(reader.Read(line));
+    ASSERT_TRUE(reader.Read(segment));
+    stream >> expected_a >> expected_line >> expected_segment;
+    EXPECT_EQ(a.x_, expected_a.x_);
+    EXPECT_EQ(a.y_, expected_a.y_);
+    EXPECT_EQ(line.A_, expected_line.A_);
+    EXPECT_EQ(line.B_, expected_line.B_);
+    EXPECT_EQ(line.C_, expected_line.C_);
+    EXPECT_EQ(segment.a_.x_, 7);
+    EXPECT_EQ(segment.b_.y_, 10);
+
+    olymp_geometry::BasicBeam<int64_t> beam;
+    EXPECT_FALSE(reader.AtEnd());
+    ASSERT_TRUE(reader.Read(beam));
+    EXPECT_EQ(beam.b_.y_, 14);
+    EXPECT_TRUE(reader.AtEnd());
+    EXPECT_FALSE(reader.Failed());
+    EXPECT_FALSE(reader.Read(beam));
+    EXPECT_TRUE(reader.Failed());
+}
+
+TEST(FastIo, Batches) {
+    std::string input;
+    for (int i = 0; i < 10; ++i) {
+        input += std::to_string(i) + " " + std::to_string(-i) + "\n";
+    }
+    FastReader reader(input);
+    std::vector<olymp_geometry::Vector> points;
+    EXPECT_EQ(reader.Read(points, 4), 4u);
+    EXPECT_EQ(reader.Read(points, 4), 4u);
+    EXPECT_EQ(reader.Read(points, 4), 2u);
+    ASSERT_EQ(points.size(), 10u);
+    EXPECT_EQ(points[7].x_, 7);
+    EXPECT_EQ(points[7].y_, -7);
+    EXPECT_TRUE(reader.AtEnd());
+    EXPECT_TRUE(reader.Failed());
+}
+
+TEST(FastIo, GeometryStore) {
+    std::string input = "3 0 0 4 0 4 3\n2 1 1 2 2\n0\n4 1 2 3";
+    FastReader reader(input);
+    olymp_geometry::BasicGeometryStore<int64_t> store;
+    EXPECT_EQ(reader.Read(store, 2), 2u);
+    EXPECT_EQ(reader.Read(store, 5), 1u);
+    EXPECT_TRUE(reader.Failed());
+    ASSERT_EQ(store.Size(), 3u);
+    EXPECT_EQ(store.VertexCount(), 5u);
+    EXPECT_EQ(store[0][2].y_, 3);
+    EXPECT_EQ(store[1].Size(), 2u);
+    EXPECT_TRUE(store[2].Empty());
+
+    std::ostringstream out;
+    {
+        FastWriter writer(out);
+        for (std::size_t i = 0; i < store.Size(); ++i) {
+            writer.Write(store[i]).Write('\n');
+        }
+    }
+    EXPECT_EQ(out.str(), "3 0 0 4 0 4 3\n2 1 1 2 2\n0\n");
+}
+
+TEST(FastIo, Malformed) {
+    FastReader reader("1 x 3");
+    double value;
+    EXPECT_TRUE(reader.Read(value));
+    EXPECT_FALSE(reader.Read(value));
+    EXPECT_FALSE(reader.Read(value));
+    EXPECT_TRUE(reader.Failed());
+}
+
+TEST(FastIo, RoundTrip) {
+    std::mt19937_64 random(7);
+    std::uniform_real_distribution<double> coordinate(-1e9, 1e9);
+    std::vector<olymp_geometry::BasicSegment<double>> segments;
+    for (int i = 0; i < 1000; ++i) {
+        segments.push_back({{coordinate(random), coordinate(random)},
+                            {coordinate(random), coordinate(random) * 1e-12}});
+    }
+
+    std::ostringstream out;
+    {
+        FastWriter writer(out, 128);
+        for (const auto &segment : segments) {
+            writer.Write(segment).Write('\n');
+        }
+        writer.Write("end");
+    }
+    std::string text = out.str();
+    ASSERT_EQ(text.substr(text.size() - 3), "end");
+
+    FastReader reader(text);
+    std::vector<olymp_geometry::BasicSegment<double>> read;
+    EXPECT_EQ(reader.Read(read, segments.size()), segments.size());
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+        EXPECT_EQ(read[i].a_.x_, segments[i].a_.x_);
+        EXPECT_EQ(read[i].a_.y_, segments[i].a_.y_);
+        EXPECT_EQ(read[i].b_.x_, segments[i].b_.x_);
+        EXPECT_EQ(read[i].b_.y_, segments[i].b_.y_);
+    }
+
+    std::ostringstream small;
+    FastWriter(small).Write(olymp_geometry::BasicLine<int64_t>(1, -2, 3)).Write(' ').Write(0.5L);
+    EXPECT_EQ(small.str(), "1 -2 3 0.5");
+}
+
+TEST(FastIo, MappedFile) {
+    std::filesystem::path path =
+            std::filesystem::temp_directory_path() / "olymp_geometry_fast_io.txt";
+    {
+        std::ofstream file(path);
+        file << "0 0 3 4\n";
+    }
+    olymp_geometry::MappedFile file(path.string());
+    ASSERT_TRUE(file.IsOpen());
+    olymp_geometry::MappedFile moved(std::move(file));
+    FastReader reader(moved.View());
+    olymp_geometry::Segment segment;
+    ASSERT_TRUE(reader.Read(segment));
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(segment.a_, segment.b_), 5);
+    std::filesystem::remove(path);
+
+    EXPECT_FALSE(olymp_geometry::MappedFile((path / "missing").string()).IsOpen());
+}
+
+TEST(FastIo, IstreamConstructors) {
+    // Раньше конструкторы отрезка и луча читали из std::cin вместо переданного потока.
+    std::istringstream in("1 2 3 4 5 6 7 8");
+    olymp_geometry::Segment segment(in);
+    olymp_geometry::Beam beam(in);
+    EXPECT_EQ(segment.b_.y_, 4);
+    EXPECT_EQ(beam.a_.x_, 5);
+    EXPECT_EQ(beam.b_.y_, 8);
+
+    std::ostringstream out;
+    out << segment;
+    EXPECT_EQ(out.str(), "1 2 3 4");
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "../lib/geometry-store.h"
+#include "../lib/polygon.h"
+
+#include <memory_resource>
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+
+    // Считает выделения, передавая их дальше в ресурс по умолчанию.
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        std::size_t allocations_ = 0;
+
+    private:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations_;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+    };
+}
+
+TEST(GeometryStore, ShapesAndViews) {
+    olymp_geometry::GeometryStore store;
+    EXPECT_TRUE(store.Empty());
+    std::vector<Vector> triangle = {Vector(0, 0), Vector(4, 0), Vector(0, 3)};
+    EXPECT_EQ(store.Add(triangle), 0u);
+    store.PushVertex(Vector(1, 1));
+    store.PushVertex(olymp_geometry::BasicVector<int>(2, 5));
+    EXPECT_EQ(store.Size(), 1u);
+    EXPECT_EQ(store.CloseShape(), 1u);
+    EXPECT_EQ(store.Add(triangle.begin(), triangle.begin()), 2u);
+
+    ASSERT_EQ(store.Size(), 3u);
+    EXPECT_EQ(store.VertexCount(), 5u);
+    EXPECT_EQ(store.Offsets(), (std::pmr::vector<std::size_t>{0, 3, 5, 5}));
+    EXPECT_EQ(store[0].Size(), 3u);
+    EXPECT_EQ(store[1][1], Vector(2, 5));
+    EXPECT_TRUE(store[2].Empty());
+    std::vector<Vector> copy(store[0].begin(), store[0].end());
+    EXPECT_EQ(copy, triangle);
+    EXPECT_FLOAT_EQ(olymp_geometry::BasicPolygon<double>(store[0]).Area(), 6);
+
+    store.PushVertex(Vector(7, 7));
+    store.DiscardShape();
+    EXPECT_EQ(store.VertexCount(), 5u);
+
+    store.Clear();
+    EXPECT_TRUE(store.Empty());
+    EXPECT_EQ(store.VertexCount(), 0u);
+    EXPECT_EQ(store.Add(triangle), 0u);
+}
+
+TEST(GeometryStore, ReusesMemory) {
+    CountingResource counting;
+    olymp_geometry::GeometryStore store(&counting);
+    EXPECT_EQ(store.get_allocator().resource(), &counting);
+    std::vector<Vector> square = {Vector(0, 0), Vector(1, 0), Vector(1, 1), Vector(0, 1)};
+    for (int batch = 0; batch < 5; ++batch) {
+        store.Clear();
+        for (int i = 0; i < 1000; ++i) {
+            store.Add(square);
+        }
+        if (batch == 0) {
+            counting.allocations_ = 0;
+        }
+    }
+    EXPECT_EQ(counting.allocations_, 0u);
+    EXPECT_EQ(store.Size(), 1000u);
+}
+
+TEST(GeometryStore, MonotonicArena) {
+    CountingResource counting;
+    std::pmr::monotonic_buffer_resource arena(1 << 16, &counting);
+    std::pmr::vector<olymp_geometry::GeometryStore> stores(&arena);
+    stores.emplace_back();
+    EXPECT_EQ(stores[0].get_allocator().resource(), &arena);
+    for (int i = 0; i < 100; ++i) {
+        stores[0].Add(std::vector<Vector>{Vector(i, 0), Vector(0, i)});
+    }
+    EXPECT_EQ(stores[0][99][0], Vector(99, 0));
+    // Всё выделено из одного начального блока арены.
+    EXPECT_EQ(counting.allocations_, 1u);
+}
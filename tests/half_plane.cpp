@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include "../lib/half-plane.h"
+
+#include <cmath>
+#include <random>
+
+template <typename T>
+class HalfPlane : public ::testing::Test {};
+
+using CoordinateTypes = ::testing::Types<double, int64_t>;
+TYPED_TEST_SUITE(HalfPlane, CoordinateTypes);
+
+namespace {
+    using olymp_geometry::RegionKind;
+
+    template <typename T>
+    using Lines = std::vector<olymp_geometry::BasicLine<T>>;
+    using Point = olymp_geometry::BasicVector<long double>;
+
+    // Полуплоскость A * x + B * y + C >= 0 с допуском.
+    template <typename T, typename U>
+    bool InsideAll(const Lines<T> &lines, const olymp_geometry::BasicVector<U> &p,
+                   long double tolerance) {
+        for (const auto &line : lines) {
+            if (line.A_ * p.x_ + line.B_ * p.y_ + line.C_ < -tolerance) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename U>
+    long double Area(const std::vector<olymp_geometry::BasicVector<U>> &polygon) {
+        long double area = 0;
+        for (std::size_t i = 0; i < polygon.size(); ++i) {
+            area += olymp_geometry::VectorMultiplication(polygon[i],
+                                                         polygon[(i + 1) % polygon.size()]);
+        }
+        return area / 2;
+    }
+
+    // Перебор: вершины области - попарные пересечения прямых, лежащие во всех полуплоскостях,
+    // а площадь выпуклой области - площадь их выпуклой оболочки.
+    template <typename T>
+    std::pair<bool, long double> BruteForce(const Lines<T> &lines) {
+        std::vector<Point> vertices;
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            for (std::size_t j = i + 1; j < lines.size(); ++j) {
+                olymp_geometry::BasicLine<long double> a(lines[i]), b(lines[j]);
+                long double d = a.A_ * b.B_ - b.A_ * a.B_;
+                if (d == 0) {
+                    continue;
+                }
+                Point p((a.B_ * b.C_ - b.B_ * a.C_) / d, (b.A_ * a.C_ - a.A_ * b.C_) / d);
+                if (InsideAll(lines, p, 1e-9)) {
+                    vertices.push_back(p);
+                }
+            }
+        }
+        if (vertices.empty()) {
+            return {false, 0};
+        }
+        Point center(0, 0);
+        for (const Point &p : vertices) {
+            center = center + p;
+        }
+        center = Point(center.x_ / vertices.size(), center.y_ / vertices.size());
+        std::sort(vertices.begin(), vertices.end(), [&](const Point &a, const Point &b) {
+            return std::atan2(a.y_ - center.y_, a.x_ - center.x_) <
+                   std::atan2(b.y_ - center.y_, b.x_ - center.x_);
+        });
+        return {true, Area(vertices)};
+    }
+}
+
+TYPED_TEST(HalfPlane, Square) {
+    using T = TypeParam;
+    using Line = olymp_geometry::BasicLine<T>;
+    // 0 <= x <= 2, 0 <= y <= 3 и лишняя прямая x + y <= 10.
+    Lines<T> lines = {Line(1, 0, 0), Line(-1, 0, 2), Line(0, 1, 0), Line(0, -1, 3),
+                      Line(-1, -1, 10)};
+    auto region = olymp_geometry::HalfPlaneIntersection(lines);
+    ASSERT_EQ(region.kind_, RegionKind::kBounded);
+    ASSERT_EQ(region.vertices_.size(), 4u);
+    EXPECT_FLOAT_EQ(Area(region.vertices_), 6);
+
+    // Сторона как у SideOfLine: BasicLine(a, b) оставляет точки справа от a -> b.
+    using Vector = olymp_geometry::BasicVector<T>;
+    Lines<T> triangle = {Line(Vector(0, 0), Vector(0, 4)), Line(Vector(0, 4), Vector(4, 0)),
+                         Line(Vector(4, 0), Vector(0, 0))};
+    EXPECT_EQ(olymp_geometry::SideOfLine(triangle[0], Vector(1, 1)), 1);
+    region = olymp_geometry::HalfPlaneIntersection(triangle);
+    ASSERT_EQ(region.kind_, RegionKind::kBounded);
+    EXPECT_FLOAT_EQ(Area(region.vertices_), 8);
+}
+
+TYPED_TEST(HalfPlane, EmptyAndUnbounded) {
+    using T = TypeParam;
+    using Line = olymp_geometry::BasicLine<T>;
+    // x >= 1 и x <= 0.
+    auto region = olymp_geometry::HalfPlaneIntersection(Lines<T>{Line(1, 0, -1), Line(-1, 0, 0)});
+    EXPECT_EQ(region.kind_, RegionKind::kEmpty);
+    // Треугольник без одной стороны.
+    region = olymp_geometry::HalfPlaneIntersection(Lines<T>{Line(1, 0, 0), Line(0, 1, 0)}, T(10));
+    ASSERT_EQ(region.kind_, RegionKind::kUnbounded);
+    EXPECT_FLOAT_EQ(Area(region.vertices_), 100);
+    // Полоса 0 <= y <= 1.
+    region = olymp_geometry::HalfPlaneIntersection(Lines<T>{Line(0, 1, 0), Line(0, -1, 1)});
+    EXPECT_EQ(region.kind_, RegionKind::kUnbounded);
+    // Пустой набор - вся плоскость, 0 * x + 0 * y - 1 >= 0 - пустое множество.
+    EXPECT_EQ(olymp_geometry::HalfPlaneIntersection(Lines<T>{}).kind_, RegionKind::kUnbounded);
+    EXPECT_EQ(olymp_geometry::HalfPlaneIntersection(Lines<T>{Line(0, 0, -1)}).kind_,
+              RegionKind::kEmpty);
+    // Треугольник, которого не хватает: x >= 0, y >= 0, x + y <= -1.
+    region = olymp_geometry::HalfPlaneIntersection(
+            Lines<T>{Line(1, 0, 0), Line(0, 1, 0), Line(-1, -1, -1)});
+    EXPECT_EQ(region.kind_, RegionKind::kEmpty);
+}
+
+TYPED_TEST(HalfPlane, Degenerate) {
+    using T = TypeParam;
+    using Line = olymp_geometry::BasicLine<T>;
+    // Отрезок y = 0, 0 <= x <= 1.
+    auto region = olymp_geometry::HalfPlaneIntersection(
+            Lines<T>{Line(0, 1, 0), Line(0, -1, 0), Line(1, 0, 0), Line(-1, 0, 1)});
+    ASSERT_EQ(region.kind_, RegionKind::kBounded);
+    EXPECT_EQ(region.vertices_.size(), 2u);
+    // Точка (0, 0).
+    region = olymp_geometry::HalfPlaneIntersection(
+            Lines<T>{Line(1, 0, 0), Line(0, 1, 0), Line(-1, -1, 0)});
+    ASSERT_EQ(region.kind_, RegionKind::kBounded);
+    ASSERT_EQ(region.vertices_.size(), 1u);
+    EXPECT_EQ(region.vertices_[0].x_, 0);
+    EXPECT_EQ(region.vertices_[0].y_, 0);
+}
+
+TYPED_TEST(HalfPlane, MatchesBruteForce) {
+    using T = TypeParam;
+    using Line = olymp_geometry::BasicLine<T>;
+    using Vector = olymp_geometry::BasicVector<T>;
+    std::mt19937 random(19);
+    for (int grid : {2, 5, 100}) {
+        std::uniform_int_distribution<int> coordinate(-grid, grid);
+        for (int test = 0; test < 300; ++test) {
+            // Рамка делает область ограниченной, остальные прямые - через точки решётки.
+            Lines<T> lines = {Line(1, 0, 2 * grid), Line(-1, 0, 2 * grid), Line(0, 1, 2 * grid),
+                              Line(0, -1, 2 * grid)};
+            int n = std::uniform_int_distribution<int>(1, 12)(random);
+            while (static_cast<int>(lines.size()) < n + 4) {
+                Vector a(coordinate(random), coordinate(random));
+                Vector b(coordinate(random), coordinate(random));
+                if (!(a == b)) {
+                    lines.emplace_back(a, b);
+                }
+            }
+            std::shuffle(lines.begin(), lines.end(), random);
+            auto region = olymp_geometry::HalfPlaneIntersection(lines);
+            auto [nonempty, area] = BruteForce(lines);
+            ASSERT_EQ(region.kind_ != RegionKind::kEmpty, nonempty) << grid << " " << test;
+            if (!nonempty) {
+                continue;
+            }
+            ASSERT_EQ(region.kind_, RegionKind::kBounded);
+            ASSERT_NEAR(Area(region.vertices_), area, 1e-6);
+            std::size_t m = region.vertices_.size();
+            for (std::size_t i = 0; i < m; ++i) {
+                ASSERT_TRUE(InsideAll(lines, region.vertices_[i], 1e-9));
+                ASSERT_TRUE(m == 1 || !(region.vertices_[i] == region.vertices_[(i + 1) % m]));
+                if (m >= 3) {
+                    ASSERT_GT(olymp_geometry::VectorMultiplication(
+                                      region.vertices_[(i + 1) % m] - region.vertices_[i],
+                                      region.vertices_[(i + 2) % m] - region.vertices_[i]),
+                              0);
+                }
+            }
+        }
+    }
+}
+
+TEST(HalfPlane, NearlyParallelTangents) {
+    // Касательные к единичной окружности с шагом угла 2 * pi / n: соседние прямые почти
+    // параллельны, и все они - стороны описанного n-угольника.
+    using Line = olymp_geometry::BasicLine<double>;
+    const std::size_t n = 40000;
+    std::vector<Line> lines;
+    for (std::size_t i = 0; i < n; ++i) {
+        double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        // Точки с cos(angle) * x + sin(angle) * y <= 1.
+        lines.emplace_back(-std::cos(angle), -std::sin(angle), 1.0);
+        // Та же касательная, сдвинутая наружу на 1e-13, ничего не меняет.
+        lines.emplace_back(-std::cos(angle), -std::sin(angle), 1.0 + 1e-13);
+    }
+    std::shuffle(lines.begin(), lines.end(), std::mt19937(1));
+    auto region = olymp_geometry::HalfPlaneIntersection(lines);
+    ASSERT_EQ(region.kind_, RegionKind::kBounded);
+    EXPECT_EQ(region.vertices_.size(), n);
+    EXPECT_NEAR(Area(region.vertices_), M_PI, 1e-6);
+
+    // Отрезая почти касающейся прямой, получаем пустую область.
+    lines.emplace_back(1.0, 0.0, -1.0 - 1e-12);
+    EXPECT_EQ(olymp_geometry::HalfPlaneIntersection(lines).kind_, RegionKind::kEmpty);
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "../lib/olymp-geometry.h"
+#include "../lib/parallel.h"
+
+#ifndef OLYMP_GEOMETRY_INSTRUMENTATION
+#error "tests/instrumentation.cpp must be built with OLYMP_GEOMETRY_INSTRUMENTATION"
+#endif
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+using olymp_geometry::Probe;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Segment = olymp_geometry::BasicSegment<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+
+    // Тест собирается и с точными предикатами: тогда полоса kEps не используется.
+#ifdef OLYMP_GEOMETRY_EXACT_PREDICATES
+    constexpr bool kExact = true;
+#else
+    constexpr bool kExact = false;
+#endif
+
+    // Замеры вне этой функции не попадают в результат.
+    template <typename Function>
+    olymp_geometry::InstrumentationSnapshot Measure(const Function &function) {
+        olymp_geometry::InstrumentationSnapshot before =
+                olymp_geometry::TakeInstrumentationSnapshot();
+        function();
+        return olymp_geometry::TakeInstrumentationSnapshot() - before;
+    }
+
+    // На этапе компиляции счётчики не трогаются, и функции остаются constexpr.
+    static_assert(olymp_geometry::LiesOn(Segment(Vector(0, 0), Vector(2, 2)), Vector(1, 1)));
+    static_assert(olymp_geometry::OnSameSideEq(Line(Vector(0, 0), Vector(1, 0)), Vector(0, 1),
+                                               Vector(3, 2)));
+}
+
+TEST(Instrumentation, IntersectBranches) {
+    Segment base(Vector(0, 0), Vector(4, 0));
+    auto counts = Measure([&] {
+        EXPECT_TRUE(Intersect(base, Segment(Vector(4, 0), Vector(5, 5))));
+        EXPECT_TRUE(Intersect(base, Segment(Vector(2, 0), Vector(2, 0))));
+        EXPECT_FALSE(Intersect(Segment(Vector(7, 7), Vector(7, 7)), base));
+        EXPECT_TRUE(Intersect(base, Segment(Vector(3, 0), Vector(6, 0))));
+        EXPECT_TRUE(Intersect(base, Segment(Vector(1, -1), Vector(1, 1))));
+        EXPECT_FALSE(Intersect(base, Segment(Vector(1, 1), Vector(2, 3))));
+    });
+    EXPECT_EQ(counts.Calls(Probe::kIntersectSegments), 6u);
+    EXPECT_EQ(counts.Calls(Probe::kIntersectSharedEndpoint), 1u);
+    EXPECT_EQ(counts.Calls(Probe::kIntersectDegenerate), 2u);
+    EXPECT_EQ(counts.Calls(Probe::kIntersectCollinear), 1u);
+    EXPECT_EQ(counts.Calls(Probe::kIntersectGeneral), 2u);
+    EXPECT_EQ(counts.Calls(Probe::kIntersectZeroOrientation), 0u);
+    // Вырожденные и совпадающие прямые проверяются через LiesOn, а общий случай без точных
+    // предикатов - через OnSameSide.
+    EXPECT_GE(counts.Calls(Probe::kLiesOnSegment), 3u);
+    EXPECT_GE(counts.Calls(Probe::kOnSameSide), kExact ? 0u : 2u);
+    EXPECT_GT(counts.Cycles(Probe::kIntersectSegments), 0u);
+}
+
+TEST(Instrumentation, EpsBand) {
+    Segment segment(Vector(0, 0), Vector(10, 0));
+    Line line(Vector(0, 0), Vector(1, 0));
+    // С точными предикатами точки в 1e-10 от прямой на ней не лежат.
+    auto counts = Measure([&] {
+        EXPECT_EQ(LiesOn(segment, Vector(5, 1e-10)), !kExact);
+        EXPECT_FALSE(LiesOn(segment, Vector(5, 1e-3)));
+        EXPECT_EQ(OnSameSideEq(line, Vector(0, 1e-10), Vector(1, -1)), !kExact);
+        EXPECT_TRUE(OnSameSideEq(line, Vector(0, 1), Vector(1, 2)));
+        EXPECT_EQ(OnSameSide(line, Vector(0, -1e-10), Vector(1, -1)), kExact);
+    });
+    const uint64_t band = kExact ? 0 : 1;
+    EXPECT_EQ(counts.Calls(Probe::kLiesOnSegment), 2u);
+    EXPECT_EQ(counts.Calls(Probe::kLiesOnEpsBand), band);
+    EXPECT_EQ(counts.Calls(Probe::kOnSameSideEq), 2u);
+    EXPECT_EQ(counts.Calls(Probe::kOnSameSideEqEpsBand), band);
+    EXPECT_EQ(counts.Calls(Probe::kOnSameSide), 1u);
+    EXPECT_EQ(counts.Calls(Probe::kOnSameSideEpsBand), band);
+    // Время замеряется только для Intersect.
+    EXPECT_EQ(counts.Cycles(Probe::kLiesOnSegment), 0u);
+}
+
+TEST(Instrumentation, OtherEntryPoints) {
+    Segment segment(Vector(0, 0), Vector(4, 0));
+    Line line(Vector(0, 0), Vector(4, 0));
+    auto counts = Measure([&] {
+        EXPECT_DOUBLE_EQ(Dist(segment, Vector(1, 3)), 3);
+        EXPECT_DOUBLE_EQ(Dist(segment, Vector(7, 4)), 5);
+        EXPECT_DOUBLE_EQ(DistSquared(segment, Vector(1, 3)), 9);
+        EXPECT_DOUBLE_EQ(DistSquared(line, Vector(9, -2)), 4);
+        EXPECT_EQ(SideOfLine(line, Vector(1, -1)), 1);
+        EXPECT_TRUE(IsBetween(Vector(1, 0), Vector(0, 1), Vector(1, 1)));
+        EXPECT_EQ(Intersection(segment, Segment(Vector(1, -1), Vector(1, 1))).kind_,
+                  olymp_geometry::IntersectionKind::kPoint);
+    });
+    // Расстояние до отрезка с проекцией внутри считается через расстояние до прямой.
+    EXPECT_EQ(counts.Calls(Probe::kDistSegment), 2u);
+    EXPECT_EQ(counts.Calls(Probe::kDistLine), 1u);
+    EXPECT_EQ(counts.Calls(Probe::kDistSquaredSegment), 1u);
+    EXPECT_EQ(counts.Calls(Probe::kDistSquaredLine), 2u);
+    EXPECT_GE(counts.Calls(Probe::kSideOfLine), 1u);
+    EXPECT_EQ(counts.Calls(Probe::kIsBetween), 1u);
+    EXPECT_EQ(counts.Calls(Probe::kIntersectionSegments), 1u);
+    EXPECT_EQ(counts.Calls(Probe::kIntersectSegments), 1u);
+    EXPECT_GT(counts.Cycles(Probe::kDistSegment), 0u);
+    EXPECT_GT(counts.Cycles(Probe::kIntersectionSegments), 0u);
+    EXPECT_EQ(counts.Cycles(Probe::kDistSquaredSegment), 0u);
+}
+
+TEST(Instrumentation, IntegerBandIsTheLine) {
+    using IntSegment = olymp_geometry::BasicSegment<int64_t>;
+    using IntVector = olymp_geometry::BasicVector<int64_t>;
+    IntSegment segment(IntVector(0, 0), IntVector(10, 10));
+    auto counts = Measure([&] {
+        EXPECT_TRUE(LiesOn(segment, IntVector(3, 3)));
+        EXPECT_FALSE(LiesOn(segment, IntVector(3, 4)));
+    });
+    EXPECT_EQ(counts.Calls(Probe::kLiesOnEpsBand), 1u);
+}
+
+TEST(Instrumentation, SumsOverThreads) {
+    Segment a(Vector(0, 0), Vector(1, 1)), b(Vector(0, 1), Vector(1, 0));
+    constexpr std::size_t kCalls = 10000;
+    auto counts = Measure([&] {
+        // Счётчики завершившегося потока остаются в сумме.
+        std::thread([&] {
+            for (int i = 0; i < 100; ++i) {
+                Intersect(a, b);
+            }
+        }).join();
+        olymp_geometry::detail::ParallelFor(0, kCalls, 64, [&](std::size_t from, std::size_t to) {
+            for (std::size_t i = from; i < to; ++i) {
+                Intersect(a, b);
+            }
+        });
+    });
+    EXPECT_EQ(counts.Calls(Probe::kIntersectSegments), kCalls + 100);
+    EXPECT_EQ(counts.Calls(Probe::kIntersectGeneral), kCalls + 100);
+}
+
+TEST(Instrumentation, Reset) {
+    Intersect(Segment(Vector(0, 0), Vector(1, 1)), Segment(Vector(0, 1), Vector(1, 0)));
+    std::thread([] { LiesOn(Segment(Vector(0, 0), Vector(1, 1)), Vector(2, 2)); }).join();
+    olymp_geometry::ResetInstrumentation();
+    auto snapshot = olymp_geometry::TakeInstrumentationSnapshot();
+    for (std::size_t i = 0; i < olymp_geometry::kProbeCount; ++i) {
+        EXPECT_EQ(snapshot.calls_[i], 0u) << olymp_geometry::ProbeName(static_cast<Probe>(i));
+        EXPECT_EQ(snapshot.cycles_[i], 0u);
+    }
+}
+
+TEST(Instrumentation, Json) {
+    olymp_geometry::ResetInstrumentation();
+    Segment base(Vector(0, 0), Vector(4, 0));
+    Intersect(base, Segment(Vector(1, -1), Vector(1, 1)));
+    Intersect(base, Segment(Vector(3, 0), Vector(6, 0)));
+    std::ostringstream out;
+    olymp_geometry::WriteInstrumentationJson(out, olymp_geometry::TakeInstrumentationSnapshot());
+    std::string json = out.str();
+    EXPECT_NE(json.find("\"enabled\": true"), std::string::npos) << json;
+    EXPECT_NE(json.find("\"cycles\": true"), std::string::npos) << json;
+    EXPECT_NE(json.find("\"intersect_segments\": {\"calls\": 2, \"cycles\": "),
+              std::string::npos)
+            << json;
+    EXPECT_NE(json.find("\"intersect_segments.collinear\": {\"calls\": 1, \"cycles\": 0}"),
+              std::string::npos)
+            << json;
+    EXPECT_NE(json.find("\"intersection_segments\": {\"calls\": 0, \"cycles\": 0}\n  }\n}"),
+              std::string::npos)
+            << json;
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "../lib/point-cloud.h"
+#include <random>
+
+namespace {
+    using olymp_geometry::SimdLevel;
+
+    const SimdLevel kLevels[] = {SimdLevel::kScalar, SimdLevel::kSse2, SimdLevel::kAvx2,
+                                 SimdLevel::kAvx512};
+
+    olymp_geometry::PointCloud RandomCloud(std::size_t size, uint32_t seed) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> coordinate(-1000, 1000);
+        olymp_geometry::PointCloud cloud;
+        for (std::size_t i = 0; i < size; ++i) {
+            cloud.PushBack({coordinate(gen), coordinate(gen)});
+        }
+        return cloud;
+    }
+}
+
+TEST(PointCloud, Layout) {
+    std::vector<olymp_geometry::BasicVector<double>> points = {{1, 2}, {3, 4}, {5, 6}};
+    olymp_geometry::PointCloud cloud(points);
+
+    ASSERT_EQ(cloud.Size(), 3u);
+    EXPECT_EQ(cloud[1], points[1]);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.X()) % 64, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cloud.Y()) % 64, 0u);
+}
+
+TEST(PointCloud, KernelsMatchScalarApi) {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+
+    const Line line(Vector(-3, 7), Vector(11, -2));
+    const Vector v(13.5, -4.25);
+    for (std::size_t size : {0, 1, 7, 8, 9, 31, 1000}) {
+        olymp_geometry::PointCloud cloud = RandomCloud(size, size);
+        // Точки прямо на прямой проверяют нулевую сторону.
+        if (size > 2) {
+            cloud.Set(1, Vector(-3, 7));
+            cloud.Set(2, Vector(4, 2.5));
+        }
+        for (SimdLevel level : kLevels) {
+            olymp_geometry::SetSimdLevel(level);
+            std::vector<double> dist_line(size), dist_point(size), scalar(size), vector(size);
+            std::vector<int8_t> side(size);
+            olymp_geometry::Dist(line, cloud, dist_line.data());
+            olymp_geometry::Dist(v, cloud, dist_point.data());
+            olymp_geometry::ScalarMultiplication(v, cloud, scalar.data());
+            olymp_geometry::VectorMultiplication(v, cloud, vector.data());
+            olymp_geometry::SideOfLine(line, cloud, side.data());
+
+            for (std::size_t i = 0; i < size; ++i) {
+                EXPECT_NEAR(dist_line[i], olymp_geometry::Dist(line, cloud[i]), 1e-9);
+                EXPECT_NEAR(dist_point[i], olymp_geometry::Dist(v, cloud[i]), 1e-9);
+                EXPECT_NEAR(scalar[i], olymp_geometry::ScalarMultiplication(v, cloud[i]), 1e-9);
+                EXPECT_NEAR(vector[i], olymp_geometry::VectorMultiplication(v, cloud[i]), 1e-9);
+                EXPECT_EQ(side[i], olymp_geometry::SideOfLine(line, cloud[i]));
+            }
+        }
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
+
+TEST(PointCloud, NormalizedLineKernels) {
+    using Vector = olymp_geometry::BasicVector<double>;
+
+    const olymp_geometry::BasicNormalizedLine<double> line(Vector(-3, 7), Vector(11, -2));
+    for (std::size_t size : {0, 1, 7, 8, 9, 31, 1000}) {
+        olymp_geometry::PointCloud cloud = RandomCloud(size, size + 100);
+        if (size > 2) {
+            cloud.Set(1, Vector(-3, 7));
+            cloud.Set(2, Vector(4, 2.5));
+        }
+        for (SimdLevel level : kLevels) {
+            olymp_geometry::SetSimdLevel(level);
+            std::vector<double> signed_dist(size), dist(size);
+            std::vector<int8_t> side(size);
+            olymp_geometry::SignedDist(line, cloud, signed_dist.data());
+            olymp_geometry::Dist(line, cloud, dist.data());
+            olymp_geometry::SideOfLine(line, cloud, side.data());
+
+            for (std::size_t i = 0; i < size; ++i) {
+                EXPECT_NEAR(signed_dist[i], olymp_geometry::SignedDist(line, cloud[i]), 1e-9);
+                EXPECT_NEAR(dist[i], olymp_geometry::Dist(line, cloud[i]), 1e-9);
+                EXPECT_EQ(side[i], olymp_geometry::SideOfLine(line, cloud[i]));
+            }
+        }
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
+
+TEST(PointCloud, SideAtEpsBoundary) {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+
+    // Значение A*x + B*y + C у точек отличается от kEps в пятом знаке, так что сторону
+    // решают последние биты, и FMA с другим округлением меняла бы её.
+    const Vector a(-3.25, 7.5), b(11.125, -2.75);
+    const Line line(a, b);
+    const olymp_geometry::BasicNormalizedLine<double> normalized(a, b);
+    const double eps = olymp_geometry::kEpsOf<double>;
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> along(-100, 100), scale(1 - 1e-4, 1 + 1e-4);
+    olymp_geometry::PointCloud cloud, normalized_cloud;
+    for (std::size_t i = 0; i < 20000; ++i) {
+        double t = along(gen), offset = (i % 2 == 0 ? 1 : -1) * eps * scale(gen);
+        Vector on_line(a.x_ + (b.x_ - a.x_) * t, a.y_ + (b.y_ - a.y_) * t);
+        double k = offset / (line.A_ * line.A_ + line.B_ * line.B_);
+        cloud.PushBack(on_line + Vector(line.A_ * k, line.B_ * k));
+        normalized_cloud.PushBack(
+                on_line + Vector(normalized.A_ * offset, normalized.B_ * offset));
+    }
+
+    for (SimdLevel level : kLevels) {
+        olymp_geometry::SetSimdLevel(level);
+        std::vector<int8_t> side(cloud.Size()), normalized_side(cloud.Size());
+        olymp_geometry::SideOfLine(line, cloud, side.data());
+        olymp_geometry::SideOfLine(normalized, normalized_cloud, normalized_side.data());
+        std::size_t mismatches = 0, normalized_mismatches = 0;
+        for (std::size_t i = 0; i < cloud.Size(); ++i) {
+            mismatches += side[i] != olymp_geometry::SideOfLine(line, cloud[i]);
+            int8_t expected = olymp_geometry::SideOfLine(normalized, normalized_cloud[i]);
+            normalized_mismatches += normalized_side[i] != expected;
+        }
+        EXPECT_EQ(mismatches, 0u) << static_cast<int>(level);
+        EXPECT_EQ(normalized_mismatches, 0u) << static_cast<int>(level);
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
+
+TEST(PointCloud, IntegerFallback) {
+    using Vector = olymp_geometry::BasicVector<int64_t>;
+    olymp_geometry::BasicPointCloud<int64_t> cloud({{0, 0}, {3, 4}, {-1, 2}});
+    std::vector<long double> dist(cloud.Size());
+    std::vector<int8_t> side(cloud.Size());
+
+    olymp_geometry::Dist(Vector(0, 0), cloud, dist.data());
+    olymp_geometry::SideOfLine(olymp_geometry::BasicLine<int64_t>(Vector(0, 0), Vector(1, 0)),
+                               cloud, side.data());
+
+    EXPECT_FLOAT_EQ(dist[1], 5);
+    EXPECT_EQ(side[0], 0);
+    EXPECT_EQ(side[1], -1);
+    EXPECT_EQ(side[2], -1);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "../lib/polygon.h"
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+using olymp_geometry::BasicPolygon;
+using olymp_geometry::BasicVector;
+
+namespace {
+    using Vector = BasicVector<double>;
+
+    BasicPolygon<double> RegularPolygon(int n, bool clockwise) {
+        std::vector<Vector> vertices;
+        for (int i = 0; i < n; ++i) {
+            double angle = 2 * M_PI * i / n * (clockwise ? -1 : 1);
+            vertices.emplace_back(10 * std::cos(angle), 10 * std::sin(angle));
+        }
+        return BasicPolygon<double>(vertices);
+    }
+}
+
+TEST(Polygon, Properties) {
+    BasicPolygon<int64_t> square{{0, 0}, {4, 0}, {4, 4}, {0, 4}};
+    EXPECT_EQ(square.Orientation(), 1);
+    EXPECT_TRUE(square.IsConvex());
+    EXPECT_FLOAT_EQ(square.Area(), 16);
+
+    BasicPolygon<int64_t> clockwise{{0, 0}, {0, 4}, {2, 4}, {4, 4}, {4, 0}};
+    EXPECT_EQ(clockwise.Orientation(), -1);
+    EXPECT_TRUE(clockwise.IsConvex());
+
+    BasicPolygon<int64_t> l_shape{{0, 0}, {4, 0}, {4, 1}, {1, 1}, {1, 4}, {0, 4}};
+    EXPECT_FALSE(l_shape.IsConvex());
+    EXPECT_FLOAT_EQ(l_shape.Area(), 7);
+
+    std::vector<BasicVector<int64_t>> pentagon = {{0, 10}, {-9, 3}, {-6, -8}, {6, -8}, {9, 3}};
+    BasicPolygon<int64_t> star{pentagon[0], pentagon[2], pentagon[4], pentagon[1], pentagon[3]};
+    EXPECT_FALSE(star.IsConvex());
+    EXPECT_FALSE(BasicPolygon<int64_t>({{0, 0}, {1, 1}, {2, 2}}).IsConvex());
+}
+
+TEST(Polygon, ContainsConvex) {
+    BasicPolygon<int64_t> square{{0, 0}, {4, 0}, {4, 4}, {0, 4}};
+    EXPECT_TRUE(olymp_geometry::Contains(square, BasicVector<int64_t>(1, 1)));
+    EXPECT_TRUE(olymp_geometry::Contains(square, BasicVector<int64_t>(0, 0)));
+    EXPECT_TRUE(olymp_geometry::Contains(square, BasicVector<int64_t>(2, 4)));
+    EXPECT_TRUE(olymp_geometry::Contains(square, BasicVector<int64_t>(0, 3)));
+    EXPECT_TRUE(olymp_geometry::Contains(square, BasicVector<int64_t>(4, 1)));
+    EXPECT_FALSE(olymp_geometry::Contains(square, BasicVector<int64_t>(5, 1)));
+    EXPECT_FALSE(olymp_geometry::Contains(square, BasicVector<int64_t>(-1, -1)));
+    EXPECT_FALSE(olymp_geometry::Contains(square, BasicVector<int64_t>(0, 5)));
+    EXPECT_FALSE(olymp_geometry::Contains(square, BasicVector<int64_t>(5, 0)));
+    EXPECT_FALSE(olymp_geometry::Contains(square, BasicVector<int64_t>(2, -1)));
+}
+
+TEST(Polygon, ConvexMatchesWinding) {
+    std::mt19937_64 random(3);
+    std::uniform_real_distribution<double> coordinate(-12, 12);
+    for (bool clockwise : {false, true}) {
+        for (int n : {3, 4, 7, 100}) {
+            BasicPolygon<double> polygon = RegularPolygon(n, clockwise);
+            ASSERT_TRUE(polygon.IsConvex());
+            for (int i = 0; i < 2000; ++i) {
+                Vector v(coordinate(random), coordinate(random));
+                bool expected = olymp_geometry::WindingNumber(polygon, v) != 0;
+                ASSERT_EQ(olymp_geometry::detail::ConvexContains(polygon, v), expected)
+                        << n << " " << v;
+            }
+            for (std::size_t i = 0; i < polygon.Size(); ++i) {
+                Vector middle((polygon[i].x_ + polygon[(i + 1) % n].x_) / 2,
+                              (polygon[i].y_ + polygon[(i + 1) % n].y_) / 2);
+                EXPECT_TRUE(olymp_geometry::Contains(polygon, polygon[i]));
+                EXPECT_TRUE(olymp_geometry::Contains(polygon, middle));
+            }
+        }
+    }
+}
+
+TEST(Polygon, WindingNumber) {
+    BasicPolygon<int64_t> l_shape{{0, 0}, {4, 0}, {4, 1}, {1, 1}, {1, 4}, {0, 4}};
+    EXPECT_EQ(olymp_geometry::WindingNumber(l_shape, BasicVector<int64_t>(3, 0)), 1);
+    EXPECT_TRUE(olymp_geometry::Contains(l_shape, BasicVector<int64_t>(2, 1)));
+    EXPECT_FALSE(olymp_geometry::Contains(l_shape, BasicVector<int64_t>(2, 2)));
+    EXPECT_FALSE(olymp_geometry::Contains(l_shape, BasicVector<int64_t>(5, 0)));
+
+    // Пентаграмма обходит центр дважды, а лучи звезды - один раз.
+    BasicPolygon<double> star{{0, 10}, {-6, -8}, {9, 3}, {-9, 3}, {6, -8}};
+    EXPECT_EQ(olymp_geometry::WindingNumber(star, Vector(0, 0)), 2);
+    EXPECT_EQ(olymp_geometry::WindingNumber(star, Vector(0, 8)), 1);
+    EXPECT_EQ(olymp_geometry::WindingNumber(star, Vector(0, -7)), 0);
+    EXPECT_EQ(olymp_geometry::WindingNumber(RegularPolygon(5, true), Vector(0, 0)), -1);
+}
+
+TEST(Polygon, Batch) {
+    std::mt19937_64 random(5);
+    std::uniform_real_distribution<double> coordinate(-12, 12);
+    std::vector<BasicPolygon<double>> polygons = {
+            RegularPolygon(50, false),
+            BasicPolygon<double>({{0, 0}, {8, 0}, {8, 2}, {2, 2}, {2, 8}, {0, 8}}),
+            BasicPolygon<double>({{0, 10}, {-6, -8}, {9, 3}, {-9, 3}, {6, -8}})};
+    olymp_geometry::BasicPointCloud<double> points;
+    for (int i = 0; i < 1000; ++i) {
+        points.PushBack({coordinate(random), coordinate(random)});
+    }
+    points.PushBack({8, 1});
+    points.PushBack({0, 10});
+    for (const auto &polygon : polygons) {
+        std::unique_ptr<bool[]> out(new bool[points.Size()]);
+        olymp_geometry::Contains(polygon, points, out.get());
+        for (std::size_t i = 0; i < points.Size(); ++i) {
+            ASSERT_EQ(out[i], olymp_geometry::Contains(polygon, points[i])) << i;
+        }
+    }
+}
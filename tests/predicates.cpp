@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include "../lib/olymp-geometry.h"
+
+#ifndef OLYMP_GEOMETRY_EXACT_PREDICATES
+#error "tests/predicates.cpp must be built with OLYMP_GEOMETRY_EXACT_PREDICATES"
+#endif
+
+#include <cmath>
+
+using olymp_geometry::Segment;
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+
+    const double kUlp = std::ldexp(1.0, -53);
+
+    // Точки вида 0.5 + k * 2^-53 после умножения на 2^53 становятся целыми, и ориентация
+    // считается точно в __int128.
+    int ExactOrientation(int64_t ax, int64_t ay, int64_t bx, int64_t by, int64_t cx,
+                         int64_t cy) {
+        __int128 det = static_cast<__int128>(bx - ax) * (cy - ay) -
+                       static_cast<__int128>(by - ay) * (cx - ax);
+        return (det > 0) - (det < 0);
+    }
+}
+
+TEST(Predicates, Orient2DNearDegenerateGrid) {
+    // Пример Кеттнера и др.: наивная ориентация относительно прямой через (12, 12) и
+    // (24, 24) на такой сетке ошибается в большом числе точек.
+    const int64_t half = int64_t{1} << 52, scale = int64_t{1} << 53;
+    for (int i = 0; i < 256; ++i) {
+        for (int j = 0; j < 256; ++j) {
+            double px = 0.5 + i * kUlp, py = 0.5 + j * kUlp;
+            int expected = ExactOrientation(half + i, half + j, 12 * scale, 12 * scale,
+                                            24 * scale, 24 * scale);
+            ASSERT_EQ(olymp_geometry::Orient2D(px, py, 12.0, 12.0, 24.0, 24.0), expected)
+                    << i << " " << j;
+        }
+    }
+}
+
+TEST(Predicates, SignsBelowRounding) {
+    double e = std::ldexp(1.0, -30);
+    // (1 + e)(1 - e) - 1 = -e^2 округляется до нуля в double.
+    EXPECT_EQ(olymp_geometry::DeterminantSign(1 + e, 1.0, 1.0, 1 - e), -1);
+    EXPECT_EQ(olymp_geometry::DeterminantSign(3.0, 5.0, 6.0, 10.0), 0);
+
+    // 3 * fl(1/3) - 1 < 0, хотя в double получается ровно 0.
+    double third = 1.0 / 3;
+    EXPECT_EQ(olymp_geometry::LinearFormSign(3.0, third, 0.0, 0.0, -1.0), -1);
+    EXPECT_EQ(olymp_geometry::LinearFormSign(2.0, 0.25, 4.0, 0.125, -1.0), 0);
+
+    EXPECT_EQ(olymp_geometry::Orient2D(Vector(0, 0), Vector(1, 0), Vector(0, 1)), 1);
+    EXPECT_EQ(olymp_geometry::Orient2D(Vector(0, 0), Vector(0, 1), Vector(1, 0)), -1);
+    EXPECT_EQ(olymp_geometry::Orient2D(Vector(0, 0), Vector(1, 1), Vector(3, 3)), 0);
+}
+
+TEST(Predicates, Determinant3) {
+    double e = std::ldexp(1.0, -30);
+    // (1 + e)(1 - e) - 1 = -e^2 теряется при округлении.
+    EXPECT_EQ(olymp_geometry::Determinant3Sign(1 + e, 1.0, 0.0, 1.0, 1 - e, 0.0, 0.0, 0.0, 1.0),
+              -1);
+    // Три прямые через (1/3, 1/3): x - y = 0, x + 2y - 1 = 0, 2x + y - 1 = 0.
+    EXPECT_EQ(olymp_geometry::Determinant3Sign(1.0, -1.0, 0.0, 1.0, 2.0, -1.0, 2.0, 1.0, -1.0),
+              0);
+    // Для целых произведения трёх коэффициентов не помещаются в int64_t.
+    const int64_t big = int64_t{1} << 40;
+    EXPECT_EQ(olymp_geometry::Determinant3Sign<int64_t>(big, 1, 0, 1, big, 0, 0, 0, big), 1);
+    EXPECT_EQ(olymp_geometry::Determinant3Sign<int64_t>(big, big + 1, big + 2, 1, 1, 1, 2, 2, 2),
+              0);
+    EXPECT_EQ(olymp_geometry::Determinant3Sign<int64_t>(big, 1, 0, 0, big, 1, 1, 0, big), 1);
+}
+
+TEST(Predicates, ScaleIndependent) {
+    // На масштабе 1e-10 сравнение с kEps считает все точки лежащими на прямой.
+    for (double scale : {1.0, 1e-10, 1e10}) {
+        Vector a(0, 0), b(scale, 0), above(0, scale), below(scale, -scale);
+        Line line(a, b);
+        EXPECT_TRUE(olymp_geometry::OnSameSide(line, above, Vector(scale * 3, scale)));
+        EXPECT_FALSE(olymp_geometry::OnSameSide(line, above, below));
+        EXPECT_FALSE(olymp_geometry::OnSameSideEq(line, above, below));
+        EXPECT_TRUE(olymp_geometry::OnSameSideEq(line, above, Vector(scale * 5, 0)));
+        EXPECT_EQ(olymp_geometry::SideOfLine(line, below),
+                  -olymp_geometry::SideOfLine(line, above));
+        EXPECT_EQ(olymp_geometry::SideOfLine(line, Vector(7 * scale, 0)), 0);
+
+        EXPECT_FALSE(olymp_geometry::IsBetween(Vector(scale, 0), Vector(0, scale),
+                                               Vector(-scale, scale)));
+        EXPECT_TRUE(olymp_geometry::IsBetween(Vector(scale, 0), Vector(0, scale),
+                                              Vector(scale, scale)));
+        EXPECT_FALSE(line == Line(Vector(0, scale), Vector(scale, scale)));
+        EXPECT_TRUE(line == Line(Vector(2 * scale, 0), Vector(5 * scale, 0)));
+
+        using Seg = olymp_geometry::BasicSegment<double>;
+        EXPECT_TRUE(olymp_geometry::Intersect(Seg(a, Vector(scale, scale)),
+                                              Seg(Vector(0, scale), b)));
+        EXPECT_FALSE(olymp_geometry::Intersect(Seg(a, b), Seg(above, Vector(scale, scale))));
+        EXPECT_TRUE(olymp_geometry::Intersect(Seg(a, Vector(4 * scale, 0)),
+                                              Seg(b, Vector(2 * scale, 0))));
+        EXPECT_TRUE(olymp_geometry::Intersect(Seg(a, b), Seg(b, b)));
+        EXPECT_FALSE(olymp_geometry::Intersect(Seg(a, b), Seg(above, above)));
+    }
+}
+
+TEST(Predicates, NearlyTouchingSegments) {
+    using Seg = olymp_geometry::BasicSegment<double>;
+    // Конец второго отрезка на одну единицу младшего разряда не доходит до первого.
+    double y = 0.5 - kUlp / 2;
+    EXPECT_FALSE(olymp_geometry::Intersect(Seg(Vector(0, 0), Vector(1, 1)),
+                                           Seg(Vector(0.5, -1), Vector(0.5, y))));
+    EXPECT_TRUE(olymp_geometry::Intersect(Seg(Vector(0, 0), Vector(1, 1)),
+                                          Seg(Vector(0.5, -1), Vector(0.5, 0.5))));
+}
+
+TEST(Predicates, LongDoubleSegments) {
+    EXPECT_TRUE(olymp_geometry::Intersect(Segment({0, 0}, {1, 1}), Segment({0, 1}, {1, 0})));
+    EXPECT_FALSE(olymp_geometry::Intersect(Segment({0, 0}, {1, 1}),
+                                           Segment({0, 1e-15L}, {1, 1 + 1e-15L})));
+}
+
+TEST(Predicates, Constexpr) {
+    // Точная ветка тоже вычисляется на этапе компиляции.
+    static_assert(olymp_geometry::Orient2D(0.5, 0.5, 12.0, 12.0, 24.0, 24.0) == 0);
+    static_assert(olymp_geometry::DeterminantSign(1.0, 2.0, 2.0, 4.0) == 0);
+    static_assert(olymp_geometry::LiesOn(olymp_geometry::BasicSegment<double>({1, 2}, {4, 6}),
+                                         Vector(2.5, 4)));
+}
+
+TEST(Predicates, FallbackCounter) {
+    olymp_geometry::ResetExactFallbackCount();
+    EXPECT_EQ(olymp_geometry::Orient2D(0.0, 0.0, 1.0, 0.0, 0.5, 1.0), 1);
+    EXPECT_EQ(olymp_geometry::ExactFallbackCount(), 0u);
+
+    EXPECT_EQ(olymp_geometry::Orient2D(0.5, 0.5, 12.0, 12.0, 24.0, 24.0), 0);
+    EXPECT_EQ(olymp_geometry::ExactFallbackCount(), 1u);
+    olymp_geometry::DeterminantSign(1.0, 2.0, 2.0, 4.0);
+    EXPECT_EQ(olymp_geometry::ExactFallbackCount(), 2u);
+
+    olymp_geometry::ResetExactFallbackCount();
+    EXPECT_EQ(olymp_geometry::ExactFallbackCount(), 0u);
+}
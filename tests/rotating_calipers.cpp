@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "../lib/convex-hull.h"
+#include "../lib/rotating-calipers.h"
+
+#include <random>
+
+template <typename T>
+class RotatingCalipers : public ::testing::Test {};
+
+using CoordinateTypes = ::testing::Types<double, int64_t>;
+TYPED_TEST_SUITE(RotatingCalipers, CoordinateTypes);
+
+namespace {
+    template <typename T>
+    using Points = std::vector<olymp_geometry::BasicVector<T>>;
+
+    template <typename T>
+    long double BruteDiameter(const Points<T> &hull) {
+        long double best = 0;
+        for (const auto &a : hull) {
+            for (const auto &b : hull) {
+                best = std::max<long double>(best, olymp_geometry::DistSquared(a, b));
+            }
+        }
+        return best;
+    }
+
+    // Ширина и площадь прямоугольника перебором по всем рёбрам и всем вершинам.
+    template <typename T>
+    std::pair<long double, long double> BruteWidthAndArea(const Points<T> &hull) {
+        long double width = std::numeric_limits<long double>::infinity();
+        long double area = width;
+        std::size_t n = hull.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            olymp_geometry::BasicVector<long double> a(hull[i]), b(hull[(i + 1) % n]);
+            olymp_geometry::BasicVector<long double> e = b - a;
+            long double length = e.Length(), high = 0, low = 0, up = 0;
+            for (const auto &p : hull) {
+                olymp_geometry::BasicVector<long double> d = olymp_geometry::BasicVector<
+                        long double>(p) - a;
+                long double s = olymp_geometry::ScalarMultiplication(e, d) / length;
+                high = std::max(high, s);
+                low = std::min(low, s);
+                up = std::max(up, olymp_geometry::VectorMultiplication(e, d) / length);
+            }
+            width = std::min(width, up);
+            area = std::min(area, (high - low) * up);
+        }
+        return {width, area};
+    }
+}
+
+TYPED_TEST(RotatingCalipers, Rectangle) {
+    using T = TypeParam;
+    Points<T> hull = {{0, 0}, {4, 0}, {4, 1}, {0, 1}};
+    auto diameter = olymp_geometry::Diameter(hull);
+    EXPECT_FLOAT_EQ(diameter.distance_squared_, 17);
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(hull[diameter.first_], hull[diameter.second_]),
+                    17);
+    auto width = olymp_geometry::Width(hull);
+    EXPECT_FLOAT_EQ(width.width_, 1);
+    auto rectangle = olymp_geometry::MinAreaRectangle(hull);
+    EXPECT_FLOAT_EQ(rectangle.area_, 4);
+
+    // Ромб: описанный прямоугольник повёрнут на 45 градусов, его площадь - площадь ромба.
+    Points<T> rhombus = {{0, -2}, {2, 0}, {0, 2}, {-2, 0}};
+    rectangle = olymp_geometry::MinAreaRectangle(rhombus);
+    EXPECT_FLOAT_EQ(rectangle.area_, 8);
+    for (std::size_t k = 0; k < 4; ++k) {
+        EXPECT_NEAR(rectangle.corners_[k].x_, rhombus[(rectangle.edge_ + k) % 4].x_, 1e-9);
+        EXPECT_NEAR(rectangle.corners_[k].y_, rhombus[(rectangle.edge_ + k) % 4].y_, 1e-9);
+    }
+    EXPECT_FLOAT_EQ(olymp_geometry::Width(rhombus).width_, 2 * std::sqrt(2.0L));
+}
+
+TYPED_TEST(RotatingCalipers, Degenerate) {
+    using T = TypeParam;
+    EXPECT_EQ(olymp_geometry::Diameter(Points<T>{{1, 1}}).distance_squared_, 0);
+    auto diameter = olymp_geometry::Diameter(Points<T>{{1, 1}, {4, 5}});
+    EXPECT_FLOAT_EQ(diameter.distance_squared_, 25);
+    EXPECT_EQ(olymp_geometry::Width(Points<T>{{1, 1}, {4, 5}}).width_, 0);
+    EXPECT_EQ(olymp_geometry::MinAreaRectangle(Points<T>{{1, 1}, {4, 5}}).area_, 0);
+}
+
+TYPED_TEST(RotatingCalipers, MatchesBruteForce) {
+    using T = TypeParam;
+    std::mt19937_64 random(47);
+    for (std::size_t n : {3, 5, 20, 200, 2000}) {
+        for (int range : {3, 1000000}) {
+            std::uniform_int_distribution<int> coordinate(-range, range);
+            Points<T> points;
+            for (std::size_t i = 0; i < n; ++i) {
+                points.emplace_back(coordinate(random), coordinate(random));
+            }
+            Points<T> hull = olymp_geometry::ConvexHull(points);
+            if (hull.size() < 3) {
+                continue;
+            }
+            auto diameter = olymp_geometry::Diameter(hull);
+            ASSERT_EQ(static_cast<long double>(diameter.distance_squared_), BruteDiameter(hull));
+            ASSERT_EQ(static_cast<long double>(olymp_geometry::DistSquared(
+                              hull[diameter.first_], hull[diameter.second_])),
+                      BruteDiameter(hull));
+
+            auto [width, area] = BruteWidthAndArea(hull);
+            long double tolerance = 1e-9 * range * range;
+            ASSERT_NEAR(olymp_geometry::Width(hull).width_, width, 1e-9 * range);
+            auto rectangle = olymp_geometry::MinAreaRectangle(hull);
+            ASSERT_NEAR(rectangle.area_, area, tolerance);
+            // Все вершины внутри прямоугольника.
+            for (const auto &p : hull) {
+                olymp_geometry::BasicVector<long double> v(p);
+                for (std::size_t k = 0; k < 4; ++k) {
+                    olymp_geometry::BasicVector<long double> a(rectangle.corners_[k]),
+                            b(rectangle.corners_[(k + 1) % 4]);
+                    ASSERT_GE(olymp_geometry::VectorMultiplication(b - a, v - a),
+                              -tolerance * range);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,274 @@
+#include <gtest/gtest.h>
+#include "../lib/olymp-geometry.h"
+
+template <typename T>
+class ScalarTypes : public ::testing::Test {};
+
+using Scalars = ::testing::Types<float, double, long double, int64_t>;
+TYPED_TEST_SUITE(ScalarTypes, Scalars);
+
+TYPED_TEST(ScalarTypes, Multiplication) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    Vector a(3, 4), b(-2, 5);
+
+    EXPECT_EQ(olymp_geometry::ScalarMultiplication(a, b), 14);
+    EXPECT_EQ(olymp_geometry::VectorMultiplication(a, b), 23);
+    EXPECT_FLOAT_EQ(a.Length(), 5);
+}
+
+TYPED_TEST(ScalarTypes, Dist) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+    using Segment = olymp_geometry::BasicSegment<TypeParam>;
+    using Beam = olymp_geometry::BasicBeam<TypeParam>;
+
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(Vector(0, 0), Vector(6, 8)), 10);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(Line(Vector(0, 0), Vector(4, 0)), Vector(1, 3)), 3);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(Segment(Vector(0, 0), Vector(4, 0)), Vector(7, 4)), 5);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(Beam(Vector(0, 0), Vector(4, 0)), Vector(7, 4)), 4);
+}
+
+TYPED_TEST(ScalarTypes, DistSquared) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+    using Segment = olymp_geometry::BasicSegment<TypeParam>;
+    using Beam = olymp_geometry::BasicBeam<TypeParam>;
+
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(Vector(0, 0), Vector(6, 8)), 100);
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(Line(Vector(0, 0), Vector(4, 0)), Vector(1, 3)),
+                    9);
+    Segment segment(Vector(0, 0), Vector(4, 0));
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(segment, Vector(7, 4)), 25);
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(segment, Vector(-3, -4)), 25);
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(segment, Vector(2, -3)), 9);
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(Beam(Vector(0, 0), Vector(4, 0)), Vector(7, 4)),
+                    16);
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(Beam(Vector(0, 0), Vector(4, 0)), Vector(-3, 4)),
+                    25);
+
+    // Вырожденные отрезок и луч - это точка.
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(Segment(Vector(1, 1), Vector(1, 1)),
+                                                Vector(4, 5)),
+                    25);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(Segment(Vector(1, 1), Vector(1, 1)), Vector(4, 5)), 5);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(Beam(Vector(1, 1), Vector(1, 1)), Vector(4, 5)), 5);
+}
+
+TYPED_TEST(ScalarTypes, LiesOn) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Segment = olymp_geometry::BasicSegment<TypeParam>;
+
+    Segment segment(Vector(0, 0), Vector(4, 2));
+    EXPECT_TRUE(olymp_geometry::LiesOn(segment, Vector(2, 1)));
+    EXPECT_TRUE(olymp_geometry::LiesOn(segment, Vector(4, 2)));
+    EXPECT_FALSE(olymp_geometry::LiesOn(segment, Vector(6, 3)));
+    EXPECT_FALSE(olymp_geometry::LiesOn(segment, Vector(-2, -1)));
+    EXPECT_FALSE(olymp_geometry::LiesOn(segment, Vector(2, 2)));
+    EXPECT_FALSE(olymp_geometry::LiesOn(Segment(Vector(1, 1), Vector(1, 1)), Vector(2, 2)));
+}
+
+TYPED_TEST(ScalarTypes, CircleContains) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Circle = olymp_geometry::BasicCircle<TypeParam>;
+
+    Circle circle(Vector(1, 2), 5);
+    EXPECT_TRUE(olymp_geometry::Contains(circle, Vector(1, 2)));
+    EXPECT_TRUE(olymp_geometry::Contains(circle, Vector(4, 6)));
+    EXPECT_TRUE(olymp_geometry::Contains(circle, Vector(-4, 2)));
+    EXPECT_FALSE(olymp_geometry::Contains(circle, Vector(5, 6)));
+    EXPECT_TRUE(olymp_geometry::Contains(Circle(Vector(3, 3), 0), Vector(3, 3)));
+}
+
+TYPED_TEST(ScalarTypes, Intersect) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Segment = olymp_geometry::BasicSegment<TypeParam>;
+
+    EXPECT_TRUE(olymp_geometry::Intersect(Segment(Vector(0, 0), Vector(4, 4)),
+                                          Segment(Vector(0, 4), Vector(4, 0))));
+    EXPECT_TRUE(olymp_geometry::Intersect(Segment(Vector(0, 0), Vector(4, 4)),
+                                          Segment(Vector(2, 2), Vector(6, 6))));
+    EXPECT_TRUE(olymp_geometry::Intersect(Segment(Vector(2, 2), Vector(3, 3)),
+                                          Segment(Vector(0, 0), Vector(6, 6))));
+    EXPECT_FALSE(olymp_geometry::Intersect(Segment(Vector(0, 0), Vector(1, 1)),
+                                           Segment(Vector(2, 2), Vector(6, 6))));
+    EXPECT_FALSE(olymp_geometry::Intersect(Segment(Vector(0, 0), Vector(4, 0)),
+                                           Segment(Vector(0, 1), Vector(4, 1))));
+}
+
+TYPED_TEST(ScalarTypes, LineEquality) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+
+    EXPECT_TRUE(Line(Vector(0, 0), Vector(2, 2)) == Line(Vector(3, 3), Vector(5, 5)));
+    EXPECT_FALSE(Line(Vector(0, 0), Vector(2, 2)) == Line(Vector(0, 1), Vector(2, 3)));
+    EXPECT_FALSE(Line(Vector(0, 0), Vector(0, 4)) == Line(Vector(1, 0), Vector(1, 4)));
+}
+
+TYPED_TEST(ScalarTypes, NormalizedLine) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+    using NormalizedLine = olymp_geometry::BasicNormalizedLine<TypeParam>;
+
+    Line line(Vector(0, 0), Vector(4, 3));
+    NormalizedLine normalized(line);
+    EXPECT_FLOAT_EQ(normalized.GetNormal().Length(), 1);
+    EXPECT_FLOAT_EQ(olymp_geometry::SignedDist(normalized, Vector(3, -4)), 5);
+    EXPECT_FLOAT_EQ(olymp_geometry::SignedDist(normalized, Vector(-3, 4)), -5);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(normalized, Vector(1, 1)),
+                    olymp_geometry::Dist(line, Vector(1, 1)));
+    EXPECT_FLOAT_EQ(olymp_geometry::DistSquared(normalized, Vector(-3, 4)), 25);
+    EXPECT_EQ(olymp_geometry::SideOfLine(normalized, Vector(3, -4)),
+              olymp_geometry::SideOfLine(line, Vector(3, -4)));
+    EXPECT_EQ(olymp_geometry::SideOfLine(normalized, Vector(1, 1)), -1);
+    EXPECT_EQ(olymp_geometry::SideOfLine(normalized, Vector(8, 6)), 0);
+
+    auto projection = olymp_geometry::Project(normalized, Vector(3, -4));
+    EXPECT_NEAR(projection.x_, 0, 1e-4);
+    EXPECT_NEAR(projection.y_, 0, 1e-4);
+    projection = olymp_geometry::Project(NormalizedLine(Vector(0, 2), Vector(5, 2)), Vector(3, 7));
+    EXPECT_FLOAT_EQ(projection.x_, 3);
+    EXPECT_FLOAT_EQ(projection.y_, 2);
+}
+
+TYPED_TEST(ScalarTypes, IntersectionPoints) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+    using Beam = olymp_geometry::BasicBeam<TypeParam>;
+    using Segment = olymp_geometry::BasicSegment<TypeParam>;
+    using olymp_geometry::IntersectionKind;
+
+    auto point = olymp_geometry::IntersectionPoint(Line(Vector(0, 0), Vector(4, 4)),
+                                                   Line(Vector(0, 4), Vector(4, 0)));
+    ASSERT_TRUE(point);
+    EXPECT_FLOAT_EQ(point->x_, 2);
+    EXPECT_FLOAT_EQ(point->y_, 2);
+    EXPECT_FALSE(olymp_geometry::IntersectionPoint(Line(Vector(0, 0), Vector(0, 4)),
+                                                   Line(Vector(1, 0), Vector(1, 4))));
+
+    auto result = olymp_geometry::Intersection(Segment(Vector(0, 0), Vector(4, 2)),
+                                               Segment(Vector(0, 2), Vector(4, 0)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kPoint);
+    EXPECT_FLOAT_EQ(result.a_.x_, 2);
+    EXPECT_FLOAT_EQ(result.a_.y_, 1);
+    result = olymp_geometry::Intersection(Segment(Vector(0, 0), Vector(4, 0)),
+                                          Segment(Vector(6, 0), Vector(2, 0)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kOverlap);
+    EXPECT_FLOAT_EQ(result.a_.x_, 2);
+    EXPECT_FLOAT_EQ(result.b_.x_, 4);
+    result = olymp_geometry::Intersection(Segment(Vector(0, 0), Vector(4, 0)),
+                                          Segment(Vector(4, 0), Vector(6, 0)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kPoint);
+    EXPECT_FLOAT_EQ(result.a_.x_, 4);
+    EXPECT_EQ(olymp_geometry::Intersection(Segment(Vector(0, 0), Vector(1, 1)),
+                                           Segment(Vector(2, 2), Vector(6, 6)))
+                      .kind_,
+              IntersectionKind::kNone);
+
+    Line line(Vector(0, 1), Vector(1, 1));
+    result = olymp_geometry::Intersection(line, Segment(Vector(2, -1), Vector(2, 3)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kPoint);
+    EXPECT_FLOAT_EQ(result.a_.x_, 2);
+    EXPECT_FLOAT_EQ(result.a_.y_, 1);
+    EXPECT_EQ(olymp_geometry::Intersection(line, Segment(Vector(-3, 1), Vector(5, 1))).kind_,
+              IntersectionKind::kOverlap);
+    EXPECT_EQ(olymp_geometry::Intersection(line, Segment(Vector(0, 2), Vector(5, 3))).kind_,
+              IntersectionKind::kNone);
+
+    Beam beam(Vector(0, 0), Vector(1, 0));
+    result = olymp_geometry::Intersection(beam, Segment(Vector(-4, 0), Vector(3, 0)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kOverlap);
+    EXPECT_FLOAT_EQ(result.a_.x_, 0);
+    EXPECT_FLOAT_EQ(result.b_.x_, 3);
+    result = olymp_geometry::Intersection(beam, Segment(Vector(5, -1), Vector(5, 1)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kPoint);
+    EXPECT_FLOAT_EQ(result.a_.x_, 5);
+    EXPECT_EQ(olymp_geometry::Intersection(beam, Segment(Vector(-5, -1), Vector(-5, 1))).kind_,
+              IntersectionKind::kNone);
+}
+
+TYPED_TEST(ScalarTypes, CircleIntersection) {
+    using Vector = olymp_geometry::BasicVector<TypeParam>;
+    using Line = olymp_geometry::BasicLine<TypeParam>;
+    using Beam = olymp_geometry::BasicBeam<TypeParam>;
+    using Segment = olymp_geometry::BasicSegment<TypeParam>;
+    using Circle = olymp_geometry::BasicCircle<TypeParam>;
+    using olymp_geometry::IntersectionKind;
+
+    Circle circle(Vector(0, 0), 5);
+    EXPECT_TRUE(olymp_geometry::Intersect(circle, Line(Vector(0, 3), Vector(1, 3))));
+    EXPECT_TRUE(olymp_geometry::Intersect(circle, Line(Vector(-1, 5), Vector(1, 5))));
+    EXPECT_FALSE(olymp_geometry::Intersect(circle, Line(Vector(0, 6), Vector(1, 6))));
+    EXPECT_TRUE(olymp_geometry::Intersect(circle, Segment(Vector(1, 1), Vector(2, 2))));
+    EXPECT_TRUE(olymp_geometry::Intersect(circle, Segment(Vector(-9, 4), Vector(9, 4))));
+    EXPECT_FALSE(olymp_geometry::Intersect(circle, Segment(Vector(6, -9), Vector(6, 9))));
+    EXPECT_FALSE(olymp_geometry::Intersect(circle, Segment(Vector(6, 0), Vector(9, 0))));
+    EXPECT_TRUE(olymp_geometry::Intersect(circle, Beam(Vector(9, 0), Vector(8, 0))));
+    EXPECT_FALSE(olymp_geometry::Intersect(circle, Beam(Vector(9, 0), Vector(10, 0))));
+    EXPECT_TRUE(olymp_geometry::Intersect(circle, Circle(Vector(8, 6), 5)));
+    EXPECT_FALSE(olymp_geometry::Intersect(circle, Circle(Vector(8, 6), 4)));
+
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(circle, Line(Vector(0, 8), Vector(1, 8))), 3);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(circle, Line(Vector(0, 3), Vector(1, 3))), 0);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(circle, Segment(Vector(6, 8), Vector(9, 12))), 5);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(circle, Segment(Vector(-9, 7), Vector(9, 7))), 2);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(circle, Beam(Vector(0, -7), Vector(1, -7))), 2);
+    EXPECT_FLOAT_EQ(olymp_geometry::Dist(circle, Circle(Vector(0, 9), 1)), 3);
+
+    auto result = olymp_geometry::Intersection(circle, Line(Vector(0, 3), Vector(1, 3)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kTwoPoints);
+    EXPECT_FLOAT_EQ(result.a_.x_, -4);
+    EXPECT_FLOAT_EQ(result.a_.y_, 3);
+    EXPECT_FLOAT_EQ(result.b_.x_, 4);
+    EXPECT_FLOAT_EQ(result.b_.y_, 3);
+    result = olymp_geometry::Intersection(circle, Line(Vector(5, 0), Vector(5, 1)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kPoint);
+    EXPECT_FLOAT_EQ(result.a_.x_, 5);
+    EXPECT_NEAR(result.a_.y_, 0, 1e-4);
+    EXPECT_EQ(olymp_geometry::Intersection(circle, Line(Vector(0, 6), Vector(1, 6))).kind_,
+              IntersectionKind::kNone);
+
+    result = olymp_geometry::Intersection(circle, Segment(Vector(0, 3), Vector(9, 3)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kPoint);
+    EXPECT_FLOAT_EQ(result.a_.x_, 4);
+    result = olymp_geometry::Intersection(circle, Segment(Vector(9, -3), Vector(-9, -3)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kTwoPoints);
+    EXPECT_FLOAT_EQ(result.a_.x_, 4);
+    EXPECT_FLOAT_EQ(result.b_.x_, -4);
+    EXPECT_EQ(olymp_geometry::Intersection(circle, Segment(Vector(1, 1), Vector(2, 2))).kind_,
+              IntersectionKind::kNone);
+    result = olymp_geometry::Intersection(circle, Beam(Vector(0, -9), Vector(0, -8)));
+    EXPECT_EQ(result.kind_, IntersectionKind::kTwoPoints);
+    EXPECT_FLOAT_EQ(result.a_.y_, -5);
+    EXPECT_FLOAT_EQ(result.b_.y_, 5);
+
+    result = olymp_geometry::Intersection(circle, Circle(Vector(8, 0), 5));
+    EXPECT_EQ(result.kind_, IntersectionKind::kTwoPoints);
+    EXPECT_FLOAT_EQ(result.a_.x_, 4);
+    EXPECT_FLOAT_EQ(result.a_.y_, -3);
+    EXPECT_FLOAT_EQ(result.b_.x_, 4);
+    EXPECT_FLOAT_EQ(result.b_.y_, 3);
+    result = olymp_geometry::Intersection(circle, Circle(Vector(0, 8), 3));
+    EXPECT_EQ(result.kind_, IntersectionKind::kPoint);
+    EXPECT_NEAR(result.a_.x_, 0, 1e-4);
+    EXPECT_FLOAT_EQ(result.a_.y_, 5);
+    EXPECT_EQ(olymp_geometry::Intersection(circle, Circle(Vector(1, 0), 2)).kind_,
+              IntersectionKind::kNone);
+    EXPECT_EQ(olymp_geometry::Intersection(circle, circle).kind_, IntersectionKind::kOverlap);
+}
+
+TEST(ScalarTypes, Constexpr) {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Line = olymp_geometry::BasicLine<double>;
+
+    constexpr Vector kA(1, 2), kB(4, 6);
+    static_assert(olymp_geometry::ScalarMultiplication(kA, kB) == 16);
+    static_assert(olymp_geometry::VectorMultiplication(kB - kA, kA + kB) == 3 * 8 - 4 * 5);
+    static_assert(olymp_geometry::OnSameSide(Line(kA, kB), Vector(0, 10), Vector(-5, 3)));
+    static_assert(olymp_geometry::IsBetween(Vector(1, 0), Vector(0, 1), Vector(1, 1)));
+    static_assert(olymp_geometry::DistSquared(kA, kB) == 25);
+    static_assert(olymp_geometry::LiesOn(olymp_geometry::BasicSegment<double>(kA, kB),
+                                         Vector(2.5, 4)));
+    constexpr Line kLine(kA, kB);
+    static_assert(kLine.GetNormal() == (kB - kA).GetPerpendicular());
+    EXPECT_DOUBLE_EQ(kLine.A_ * kA.x_ + kLine.B_ * kA.y_ + kLine.C_, 0);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "../lib/segment-bvh.h"
+
+#include <random>
+
+template <typename T>
+class SegmentBvh : public ::testing::Test {};
+
+using CoordinateTypes = ::testing::Types<double, long double, int64_t>;
+TYPED_TEST_SUITE(SegmentBvh, CoordinateTypes);
+
+namespace {
+    enum class Layout { kRandom, kShort, kDegenerate, kCollinear };
+
+    template <typename T>
+    std::vector<olymp_geometry::BasicSegment<T>> MakeSegments(std::size_t n, Layout layout,
+                                                              std::mt19937_64 &random) {
+        std::uniform_int_distribution<int> coordinate(-1000, 1000), small(-20, 20);
+        std::vector<olymp_geometry::BasicSegment<T>> segments;
+        for (std::size_t i = 0; i < n; ++i) {
+            olymp_geometry::BasicVector<T> a(coordinate(random), coordinate(random));
+            switch (layout) {
+                case Layout::kRandom:
+                    segments.emplace_back(
+                            a, olymp_geometry::BasicVector<T>(coordinate(random),
+                                                              coordinate(random)));
+                    break;
+                case Layout::kShort:
+                    segments.emplace_back(a, a + olymp_geometry::BasicVector<T>(small(random),
+                                                                                small(random)));
+                    break;
+                case Layout::kDegenerate:
+                    segments.emplace_back(a, a);
+                    break;
+                case Layout::kCollinear:
+                    segments.emplace_back(olymp_geometry::BasicVector<T>(a.x_, 5),
+                                          olymp_geometry::BasicVector<T>(a.x_ + small(random), 5));
+                    break;
+            }
+        }
+        return segments;
+    }
+}
+
+TYPED_TEST(SegmentBvh, MatchesBruteForce) {
+    using T = TypeParam;
+    using Vector = olymp_geometry::BasicVector<T>;
+    using Segment = olymp_geometry::BasicSegment<T>;
+    std::mt19937_64 random(17);
+    for (Layout layout : {Layout::kRandom, Layout::kShort, Layout::kDegenerate,
+                          Layout::kCollinear}) {
+        for (std::size_t n : {1, 7, 100, 2000}) {
+            std::vector<Segment> segments = MakeSegments<T>(n, layout, random);
+            olymp_geometry::BasicSegmentBvh<T> bvh(segments);
+            ASSERT_EQ(bvh.Size(), n);
+            std::vector<Segment> queries = MakeSegments<T>(30, Layout::kShort, random);
+            queries.push_back(segments[0]);
+            queries.emplace_back(Vector(-1000, 5), Vector(1000, 5));
+            for (const Segment &query : queries) {
+                const Vector &v = query.a_;
+                long double best = olymp_geometry::DistSquared(segments[0], v);
+                std::vector<std::size_t> within, intersecting;
+                long double distance = 60;
+                for (std::size_t i = 0; i < n; ++i) {
+                    long double d = olymp_geometry::DistSquared(segments[i], v);
+                    best = std::min(best, d);
+                    if (d <= distance * distance) {
+                        within.push_back(i);
+                    }
+                    if (olymp_geometry::Intersect(query, segments[i])) {
+                        intersecting.push_back(i);
+                    }
+                }
+                ASSERT_EQ(olymp_geometry::DistSquared(segments[bvh.Nearest(v)], v), best);
+                ASSERT_EQ(bvh.WithinDistance(v, distance), within);
+                ASSERT_EQ(bvh.Intersecting(query), intersecting);
+            }
+        }
+    }
+}
+
+TYPED_TEST(SegmentBvh, Batch) {
+    using T = TypeParam;
+    std::mt19937_64 random(19);
+    auto segments = MakeSegments<T>(20000, Layout::kShort, random);
+    auto queries = MakeSegments<T>(3000, Layout::kShort, random);
+    std::vector<olymp_geometry::BasicVector<T>> points;
+    for (const auto &s : queries) {
+        points.push_back(s.b_);
+    }
+    olymp_geometry::SetThreadCount(4);
+    olymp_geometry::BasicSegmentBvh<T> bvh(segments);
+    std::vector<std::size_t> nearest = bvh.Nearest(points);
+    std::vector<std::vector<std::size_t>> within = bvh.WithinDistance(points, 30);
+    std::vector<std::vector<std::size_t>> intersecting = bvh.Intersecting(queries);
+    olymp_geometry::SetThreadCount(0);
+    ASSERT_EQ(nearest.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(nearest[i], bvh.Nearest(points[i]));
+        EXPECT_EQ(within[i], bvh.WithinDistance(points[i], 30));
+        EXPECT_EQ(intersecting[i], bvh.Intersecting(queries[i]));
+    }
+}
+
+TYPED_TEST(SegmentBvh, Empty) {
+    using T = TypeParam;
+    olymp_geometry::BasicSegmentBvh<T> bvh(std::vector<olymp_geometry::BasicSegment<T>>{});
+    EXPECT_EQ(bvh.Size(), 0u);
+    EXPECT_TRUE(bvh.WithinDistance({1, 2}, 100).empty());
+    EXPECT_TRUE(bvh.Intersecting({{0, 0}, {1, 1}}).empty());
+    EXPECT_TRUE(bvh.Nearest(std::vector<olymp_geometry::BasicVector<T>>{}).empty());
+}
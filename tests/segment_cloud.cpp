@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "../lib/segment-cloud.h"
+#include <random>
+
+namespace {
+    using olymp_geometry::SimdLevel;
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Segment = olymp_geometry::BasicSegment<double>;
+
+    const SimdLevel kLevels[] = {SimdLevel::kScalar, SimdLevel::kSse2, SimdLevel::kAvx2,
+                                 SimdLevel::kAvx512};
+
+    // Координаты на маленькой решётке дают много общих концов, вырожденных и лежащих на
+    // одной прямой отрезков.
+    std::vector<Segment> RandomSegments(std::size_t size, int grid, uint32_t seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> coordinate(0, grid);
+        std::vector<Segment> segments;
+        for (std::size_t i = 0; i < size; ++i) {
+            segments.emplace_back(Vector(coordinate(gen), coordinate(gen)),
+                                  Vector(coordinate(gen), coordinate(gen)));
+        }
+        return segments;
+    }
+
+    // Пары, в которых решение зависит от последних битов: конец второго отрезка в kEps от
+    // прямой первого по значению A*x + B*y + C, концы в kEps друг от друга и почти
+    // совпадающие прямые. Отступы отличаются от kEps в пятом знаке.
+    void NearEpsPairs(std::size_t size, uint32_t seed, std::vector<Segment> &first,
+                      std::vector<Segment> &second) {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> coordinate(-100, 100), along(0.1, 0.9);
+        std::uniform_real_distribution<double> scale(1 - 1e-4, 1 + 1e-4);
+        const double eps = olymp_geometry::kEpsOf<double>;
+        for (std::size_t i = 0; i < size; ++i) {
+            Vector a(coordinate(gen), coordinate(gen)), b(coordinate(gen), coordinate(gen));
+            olymp_geometry::BasicLine<double> line(a, b);
+            double t = along(gen), offset = (gen() % 2 == 0 ? 1 : -1) * eps * scale(gen);
+            double k = offset / (line.A_ * line.A_ + line.B_ * line.B_);
+            Vector shift(line.A_ * k, line.B_ * k);
+            Vector on_line(a.x_ + (b.x_ - a.x_) * t, a.y_ + (b.y_ - a.y_) * t);
+            first.emplace_back(a, b);
+            switch (i % 3) {
+                case 0:
+                    second.emplace_back(on_line + shift,
+                                        on_line + Vector(-line.A_ * 3, -line.B_ * 3));
+                    break;
+                case 1:
+                    second.emplace_back(a + Vector(offset, -offset), on_line + shift);
+                    break;
+                default:
+                    second.emplace_back(a + shift, b + shift);
+                    break;
+            }
+        }
+    }
+}
+
+TEST(SegmentCloud, OneAgainstManyMatchesIntersect) {
+    for (int grid : {3, 10, 1000}) {
+        std::vector<Segment> segments = RandomSegments(203, grid, grid);
+        olymp_geometry::SegmentCloud cloud(segments);
+        std::vector<Segment> queries = RandomSegments(30, grid, grid + 1);
+        queries.emplace_back(Vector(1, 1), Vector(1, 1));
+        for (SimdLevel level : kLevels) {
+            olymp_geometry::SetSimdLevel(level);
+            for (const Segment &query : queries) {
+                std::vector<uint64_t> mask((segments.size() + 63) / 64);
+                std::unique_ptr<bool[]> out(new bool[segments.size()]);
+                olymp_geometry::IntersectMask(query, cloud, mask.data());
+                olymp_geometry::Intersect(query, cloud, out.get());
+                for (std::size_t i = 0; i < segments.size(); ++i) {
+                    bool expected = olymp_geometry::Intersect(query, segments[i]);
+                    EXPECT_EQ((mask[i / 64] >> (i % 64)) & 1u, expected) << i;
+                    EXPECT_EQ(out[i], expected) << i;
+                }
+            }
+        }
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
+
+TEST(SegmentCloud, PairwiseMatchesIntersect) {
+    std::vector<Segment> first = RandomSegments(517, 5, 1), second = RandomSegments(517, 5, 2);
+    olymp_geometry::SegmentCloud first_cloud(first), second_cloud(second);
+    for (SimdLevel level : kLevels) {
+        olymp_geometry::SetSimdLevel(level);
+        std::vector<uint64_t> mask((first.size() + 63) / 64);
+        std::unique_ptr<bool[]> out(new bool[first.size()]);
+        olymp_geometry::IntersectMask(first_cloud, second_cloud, mask.data());
+        olymp_geometry::Intersect(first_cloud, second_cloud, out.get());
+        for (std::size_t i = 0; i < first.size(); ++i) {
+            bool expected = olymp_geometry::Intersect(first[i], second[i]);
+            EXPECT_EQ((mask[i / 64] >> (i % 64)) & 1u, expected) << i;
+            EXPECT_EQ(out[i], expected) << i;
+        }
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
+
+TEST(SegmentCloud, IntersectionMatchesScalar) {
+    using olymp_geometry::IntersectionKind;
+    using Result = olymp_geometry::IntersectionResult<double>;
+    std::vector<Segment> first = RandomSegments(517, 5, 3), second = RandomSegments(517, 5, 4);
+    olymp_geometry::SegmentCloud first_cloud(first), second_cloud(second);
+    std::vector<Result> pairwise(first.size()), one(first.size()), line(first.size());
+    olymp_geometry::BasicLine<double> query_line(Vector(0, 1), Vector(5, 3));
+    olymp_geometry::Intersection(first_cloud, second_cloud, pairwise.data());
+    olymp_geometry::Intersection(second[0], first_cloud, one.data());
+    olymp_geometry::Intersection(query_line, first_cloud, line.data());
+    for (std::size_t i = 0; i < first.size(); ++i) {
+        Result expected = olymp_geometry::Intersection(first[i], second[i]);
+        ASSERT_EQ(pairwise[i].kind_, expected.kind_) << i;
+        EXPECT_EQ(pairwise[i].kind_ != IntersectionKind::kNone,
+                  olymp_geometry::Intersect(first[i], second[i]));
+        if (expected.kind_ != IntersectionKind::kNone) {
+            EXPECT_EQ(pairwise[i].a_, expected.a_);
+            EXPECT_EQ(pairwise[i].b_, expected.b_);
+            // Найденные точки лежат на обоих отрезках.
+            for (const Vector &p : {expected.a_, expected.b_}) {
+                EXPECT_LT(olymp_geometry::Dist(first[i], p), 1e-9) << i;
+                EXPECT_LT(olymp_geometry::Dist(second[i], p), 1e-9) << i;
+            }
+        }
+        EXPECT_EQ(one[i].kind_, olymp_geometry::Intersection(second[0], first[i]).kind_);
+        EXPECT_EQ(line[i].kind_, olymp_geometry::Intersection(query_line, first[i]).kind_);
+    }
+}
+
+TEST(SegmentCloud, NearEpsMatchesIntersect) {
+    std::vector<Segment> first, second;
+    NearEpsPairs(3000, 5, first, second);
+    olymp_geometry::SegmentCloud first_cloud(first), second_cloud(second);
+    for (SimdLevel level : kLevels) {
+        olymp_geometry::SetSimdLevel(level);
+        std::vector<uint64_t> pairwise((first.size() + 63) / 64);
+        std::unique_ptr<bool[]> one(new bool[second.size()]);
+        olymp_geometry::IntersectMask(first_cloud, second_cloud, pairwise.data());
+        olymp_geometry::Intersect(first[0], second_cloud, one.get());
+        std::size_t mismatches = 0, one_mismatches = 0;
+        for (std::size_t i = 0; i < first.size(); ++i) {
+            bool expected = olymp_geometry::Intersect(first[i], second[i]);
+            mismatches += ((pairwise[i / 64] >> (i % 64)) & 1u) != expected;
+            one_mismatches += one[i] != olymp_geometry::Intersect(first[0], second[i]);
+        }
+        EXPECT_EQ(mismatches, 0u) << static_cast<int>(level);
+        EXPECT_EQ(one_mismatches, 0u) << static_cast<int>(level);
+    }
+    olymp_geometry::SetSimdLevel(olymp_geometry::DetectSimdLevel());
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "../lib/spatial-index.h"
+
+#include <random>
+
+template <typename Index>
+class SpatialIndex : public ::testing::Test {};
+
+using Indexes = ::testing::Types<olymp_geometry::BasicKdTree<double>,
+                                 olymp_geometry::BasicUniformGrid<double>,
+                                 olymp_geometry::BasicKdTree<int64_t>,
+                                 olymp_geometry::BasicUniformGrid<int64_t>>;
+TYPED_TEST_SUITE(SpatialIndex, Indexes);
+
+namespace {
+    template <typename Index>
+    struct CoordinateOf;
+
+    template <template <typename> class Index, typename T>
+    struct CoordinateOf<Index<T>> {
+        using Type = T;
+    };
+
+    enum class Layout { kRandom, kClustered, kDuplicates, kHorizontal };
+
+    template <typename T>
+    std::vector<olymp_geometry::BasicVector<T>> MakePoints(std::size_t n, Layout layout,
+                                                          std::mt19937_64 &random) {
+        std::uniform_int_distribution<int> coordinate(-1000, 1000), small(-5, 5);
+        std::vector<olymp_geometry::BasicVector<T>> points;
+        for (std::size_t i = 0; i < n; ++i) {
+            switch (layout) {
+                case Layout::kRandom:
+                    points.emplace_back(coordinate(random), coordinate(random));
+                    break;
+                case Layout::kClustered:
+                    points.emplace_back(i % 3 == 0 ? 900 + small(random) : small(random),
+                                        small(random));
+                    break;
+                case Layout::kDuplicates:
+                    points.emplace_back(small(random) / 4, small(random) / 4);
+                    break;
+                case Layout::kHorizontal:
+                    points.emplace_back(coordinate(random), 7);
+                    break;
+            }
+        }
+        return points;
+    }
+
+    template <typename T>
+    std::vector<long double> SortedDistances(
+            const std::vector<olymp_geometry::BasicVector<T>> &points,
+            const olymp_geometry::BasicVector<T> &v) {
+        std::vector<long double> result;
+        for (const auto &p : points) {
+            result.push_back(olymp_geometry::DistSquared(p, v));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+}
+
+TYPED_TEST(SpatialIndex, MatchesBruteForce) {
+    using T = typename CoordinateOf<TypeParam>::Type;
+    using Vector = olymp_geometry::BasicVector<T>;
+    std::mt19937_64 random(11);
+    for (Layout layout : {Layout::kRandom, Layout::kClustered, Layout::kDuplicates,
+                          Layout::kHorizontal}) {
+        for (std::size_t n : {1, 5, 100, 3000}) {
+            std::vector<Vector> points = MakePoints<T>(n, layout, random);
+            TypeParam index(points);
+            ASSERT_EQ(index.Size(), n);
+            std::vector<Vector> queries = MakePoints<T>(50, Layout::kRandom, random);
+            queries.emplace_back(100000, -100000);
+            queries.push_back(points[0]);
+            for (const Vector &v : queries) {
+                std::vector<long double> expected = SortedDistances(points, v);
+
+                std::size_t nearest = index.Nearest(v);
+                ASSERT_EQ(olymp_geometry::DistSquared(points[nearest], v), expected[0]);
+
+                std::vector<std::size_t> k_nearest = index.KNearest(v, 7);
+                ASSERT_EQ(k_nearest.size(), std::min<std::size_t>(7, n));
+                for (std::size_t i = 0; i < k_nearest.size(); ++i) {
+                    ASSERT_EQ(olymp_geometry::DistSquared(points[k_nearest[i]], v), expected[i]);
+                }
+
+                long double radius = 150;
+                std::vector<std::size_t> in_radius;
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (olymp_geometry::DistSquared(points[i], v) <= radius * radius) {
+                        in_radius.push_back(i);
+                    }
+                }
+                ASSERT_EQ(index.Radius(v, radius), in_radius);
+            }
+        }
+    }
+}
+
+TYPED_TEST(SpatialIndex, Batch) {
+    using T = typename CoordinateOf<TypeParam>::Type;
+    std::mt19937_64 random(13);
+    auto points = MakePoints<T>(20000, Layout::kRandom, random);
+    auto queries = MakePoints<T>(5000, Layout::kRandom, random);
+    olymp_geometry::SetThreadCount(4);
+    TypeParam index(points);
+    std::vector<std::size_t> nearest = index.Nearest(queries);
+    std::vector<std::vector<std::size_t>> k_nearest = index.KNearest(queries, 3);
+    std::vector<std::vector<std::size_t>> in_radius = index.Radius(queries, 20);
+    olymp_geometry::SetThreadCount(0);
+    ASSERT_EQ(nearest.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(nearest[i], index.Nearest(queries[i]));
+        EXPECT_EQ(k_nearest[i], index.KNearest(queries[i], 3));
+        EXPECT_EQ(in_radius[i], index.Radius(queries[i], 20));
+    }
+
+    // Параллельное построение даёт то же дерево, что и последовательное.
+    olymp_geometry::SetThreadCount(1);
+    TypeParam sequential(points);
+    olymp_geometry::SetThreadCount(0);
+    for (std::size_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(sequential.KNearest(queries[i], 3), k_nearest[i]);
+    }
+}
+
+TYPED_TEST(SpatialIndex, Empty) {
+    using T = typename CoordinateOf<TypeParam>::Type;
+    TypeParam index(std::vector<olymp_geometry::BasicVector<T>>{});
+    EXPECT_EQ(index.Size(), 0u);
+    EXPECT_TRUE(index.KNearest({1, 2}, 3).empty());
+    EXPECT_TRUE(index.Radius({1, 2}, 100).empty());
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "../lib/sweep-line.h"
+#include <random>
+
+namespace {
+    using Vector = olymp_geometry::BasicVector<double>;
+    using Segment = olymp_geometry::BasicSegment<double>;
+
+    std::vector<Segment> RandomSegments(std::size_t size, int grid, int max_length, uint32_t seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<int> coordinate(0, grid), offset(-max_length, max_length);
+        std::vector<Segment> segments;
+        for (std::size_t i = 0; i < size; ++i) {
+            Vector a(coordinate(gen), coordinate(gen));
+            segments.emplace_back(a, a + Vector(offset(gen), offset(gen)));
+        }
+        return segments;
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t>> BruteForce(
+            const std::vector<Segment> &segments) {
+        std::vector<std::pair<std::size_t, std::size_t>> pairs;
+        for (std::size_t i = 0; i < segments.size(); ++i) {
+            for (std::size_t j = i + 1; j < segments.size(); ++j) {
+                if (olymp_geometry::Intersect(segments[i], segments[j])) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+        return pairs;
+    }
+}
+
+TEST(SweepLine, AnyIntersection) {
+    std::vector<Segment> apart = {Segment(Vector(0, 0), Vector(10, 0)),
+                                  Segment(Vector(0, 1), Vector(10, 2)),
+                                  Segment(Vector(5, 3), Vector(5, 10)),
+                                  Segment(Vector(11, 0), Vector(12, 0))};
+    EXPECT_FALSE(olymp_geometry::FindAnyIntersection(apart).has_value());
+
+    apart.emplace_back(Vector(5, 2.5), Vector(5, -1));
+    auto pair = olymp_geometry::FindAnyIntersection(apart);
+    ASSERT_TRUE(pair.has_value());
+    EXPECT_TRUE(olymp_geometry::Intersect(apart[pair->first], apart[pair->second]));
+
+    for (uint32_t seed = 0; seed < 200; ++seed) {
+        std::vector<Segment> segments = RandomSegments(12, 40, 6, seed);
+        auto found = olymp_geometry::FindAnyIntersection(segments);
+        EXPECT_EQ(found.has_value(), !BruteForce(segments).empty()) << seed;
+        if (found) {
+            EXPECT_TRUE(olymp_geometry::Intersect(segments[found->first],
+                                                  segments[found->second]));
+        }
+    }
+}
+
+TEST(SweepLine, AllIntersectionsDegenerate) {
+    // Вертикальные, наложившиеся, вырожденные отрезки и несколько отрезков через одну точку.
+    std::vector<Segment> segments = {
+            Segment(Vector(0, 0), Vector(4, 4)), Segment(Vector(0, 4), Vector(4, 0)),
+            Segment(Vector(2, -1), Vector(2, 5)), Segment(Vector(1, 1), Vector(3, 3)),
+            Segment(Vector(2, 2), Vector(2, 2)), Segment(Vector(2, 5), Vector(2, 7)),
+            Segment(Vector(5, 0), Vector(6, 0))};
+    auto found = olymp_geometry::FindAllIntersections(segments);
+    auto expected = BruteForce(segments);
+    ASSERT_EQ(found.size(), expected.size());
+    for (std::size_t i = 0; i < found.size(); ++i) {
+        EXPECT_EQ(std::make_pair(found[i].first_, found[i].second_), expected[i]);
+        EXPECT_TRUE(olymp_geometry::LiesOn(segments[found[i].first_], found[i].point_));
+        EXPECT_TRUE(olymp_geometry::LiesOn(segments[found[i].second_], found[i].point_));
+    }
+}
+
+TEST(SweepLine, AllIntersectionsRandom) {
+    for (int grid : {8, 50}) {
+        for (uint32_t seed = 0; seed < 50; ++seed) {
+            std::vector<Segment> segments = RandomSegments(60, grid, grid / 3, seed);
+            auto found = olymp_geometry::FindAllIntersections(segments);
+            std::vector<std::pair<std::size_t, std::size_t>> pairs;
+            for (const auto &intersection : found) {
+                pairs.emplace_back(intersection.first_, intersection.second_);
+                EXPECT_LT(olymp_geometry::Dist(segments[intersection.first_],
+                                               intersection.point_), 1e-6);
+                EXPECT_LT(olymp_geometry::Dist(segments[intersection.second_],
+                                               intersection.point_), 1e-6);
+            }
+            EXPECT_EQ(pairs, BruteForce(segments)) << grid << " " << seed;
+        }
+    }
+
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> coordinate(-100, 100);
+    std::vector<Segment> segments;
+    for (int i = 0; i < 300; ++i) {
+        segments.emplace_back(Vector(coordinate(gen), coordinate(gen)),
+                              Vector(coordinate(gen), coordinate(gen)));
+    }
+    EXPECT_EQ(olymp_geometry::FindAllIntersections(segments).size(), BruteForce(segments).size());
+}
+
+TEST(SweepLine, ManyOverlappingCollinear) {
+    // m отрезков на одной прямой, попарно наложившихся, и вертикальные отрезки через них:
+    // каждая пара должна выдаваться один раз, а не в каждом событии наложения.
+    const int m = 400;
+    std::vector<Segment> segments;
+    for (int i = 0; i < m; ++i) {
+        segments.emplace_back(Vector(i, i), Vector(i + m, i + m));
+    }
+    for (int i = 0; i < 20; ++i) {
+        segments.emplace_back(Vector(i * 30 + 0.5, -1), Vector(i * 30 + 0.5, 2 * m));
+        segments.emplace_back(Vector(i * 30 + 0.5, -1), Vector(i * 30 + 10.5, 2 * m));
+    }
+    auto found = olymp_geometry::FindAllIntersections(segments);
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    for (const auto &intersection : found) {
+        pairs.emplace_back(intersection.first_, intersection.second_);
+        EXPECT_TRUE(olymp_geometry::LiesOn(segments[intersection.first_], intersection.point_));
+        EXPECT_TRUE(olymp_geometry::LiesOn(segments[intersection.second_], intersection.point_));
+    }
+    EXPECT_EQ(pairs, BruteForce(segments));
+    // Точка пары наложившихся - начало более позднего отрезка.
+    EXPECT_EQ(found[0].first_, 0u);
+    EXPECT_EQ(found[0].second_, 1u);
+    EXPECT_EQ(found[0].point_, Vector(1, 1));
+}
+
+TEST(SweepLine, NearlyParallelCrossing) {
+    // Наклоны отличаются меньше чем на kEps, но отрезки пересекаются, а не накладываются.
+    std::vector<Segment> segments = {Segment(Vector(-100, 0), Vector(100, 0)),
+                                     Segment(Vector(-100, -1e-7), Vector(100, 1e-7))};
+    EXPECT_EQ(olymp_geometry::FindAllIntersections(segments).size(), 1u);
+
+    // Веер почти параллельных отрезков через нецелую точку и прямая, на которой лежат
+    // два наложившихся из них.
+    const Vector center(0.37, -1.21);
+    for (int k = 1; k <= 6; ++k) {
+        Vector d(100, 0.3 + k * 1.3e-8);
+        segments.emplace_back(center - d, center + d);
+    }
+    segments.emplace_back(center - Vector(100, 0.3), center + Vector(50, 0.15));
+    segments.emplace_back(center - Vector(50, 0.15), center + Vector(100, 0.3));
+    auto found = olymp_geometry::FindAllIntersections(segments);
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    for (const auto &intersection : found) {
+        pairs.emplace_back(intersection.first_, intersection.second_);
+    }
+    EXPECT_EQ(pairs, BruteForce(segments));
+}
@@ -1,6 +1,5 @@
 #include <gtest/gtest.h>
 #include "../lib/olymp-geometry.h"
-#include "../lib/olymp-geometry.cpp"
 #include <filesystem>
 #include <fstream>
 